@@ -715,6 +715,19 @@ HRESULT CLR_RT_HeapBlock::PerformBoxing( const CLR_RT_TypeDef_Instance& cls )
 
         if(dtl.m_flags & CLR_RT_DataTypeLookup::c_OptimizedValueType)
         {
+#if defined(TINYCLR_BOXING_CACHE)
+            CLR_RT_HeapBlock** slot = (obj == this) ? g_CLR_RT_ExecutionEngine.BoxCache_Slot( cls, *this ) : NULL;
+
+            if(slot && *slot)
+            {
+                g_CLR_RT_ExecutionEngine.m_boxCacheHits++;
+
+                this->SetObjectReference( *slot );
+
+                TINYCLR_SET_AND_LEAVE(S_OK);
+            }
+#endif
+
             CLR_RT_HeapBlock* ptr = g_CLR_RT_ExecutionEngine.ExtractHeapBlocksForClassOrValueTypes( DATATYPE_VALUETYPE, HB_Boxed, cls, 2 ); FAULT_ON_NULL(ptr);
 
             switch(dataType)
@@ -728,6 +741,12 @@ HRESULT CLR_RT_HeapBlock::PerformBoxing( const CLR_RT_TypeDef_Instance& cls )
             ptr[ 1 ].SetDataId ( CLR_RT_HEAPBLOCK_RAW_ID(dataType,0,1) );
             ptr[ 1 ].AssignData( *this                                 );
 
+#if defined(TINYCLR_BOXING_CACHE)
+            if(slot) *slot = ptr;
+
+            g_CLR_RT_ExecutionEngine.m_boxAllocations++;
+#endif
+
             this->SetObjectReference( ptr );
         }
         else if(dt == DATATYPE_OBJECT)
@@ -742,6 +761,10 @@ HRESULT CLR_RT_HeapBlock::PerformBoxing( const CLR_RT_TypeDef_Instance& cls )
             TINYCLR_CHECK_HRESULT(g_CLR_RT_ExecutionEngine.CloneObject( *this, *ptr ));
 
             this->Dereference()->Box();
+
+#if defined(TINYCLR_BOXING_CACHE)
+            g_CLR_RT_ExecutionEngine.m_boxAllocations++;
+#endif
         }
         else
         {
@@ -900,9 +923,12 @@ CLR_UINT32 CLR_RT_HeapBlock::GetHashCode( CLR_RT_HeapBlock* ptr, bool fRecurse,
 
     case DATATYPE_STRING:
         {
-            LPCSTR szText = ptr->StringText();
+            CLR_UINT32 hash = ((CLR_RT_HeapBlock_String*)ptr)->HashCode();
 
-            crc = SUPPORT_ComputeCRC( szText, (int)hal_strlen_s( szText ), crc );
+            //
+            // A string on its own hashes to its cached value; as part of a bigger object its hash is folded in.
+            //
+            crc = crc ? SUPPORT_ComputeCRC( &hash, sizeof(hash), crc ) : hash;
         }
         break;
 
@@ -1766,7 +1792,10 @@ void CLR_RT_HeapBlock::Relocate_Obj()
 void CLR_RT_HeapBlock::Relocate_Cls()
 {
     NATIVE_PROFILE_CLR_CORE();
-    CLR_RT_GarbageCollector::Heap_Relocate( (void**)&m_data.objectHeader.lock );
+    if(!IsObjectThinLocked())
+    {
+        CLR_RT_GarbageCollector::Heap_Relocate( (void**)&m_data.objectHeader.lock );
+    }
 
     CLR_RT_GarbageCollector::Heap_Relocate( this + 1, DataSize() - 1 );
 }
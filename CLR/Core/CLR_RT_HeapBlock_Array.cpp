@@ -163,6 +163,37 @@ bool CLR_RT_HeapBlock_Array::CheckRange( int index, int length, int numOfElement
     return true;
 }
 
+//
+// Returns how many steps of 'incr' elements from 'data' the first match is, or -1.
+//
+template <typename T> static int IndexOf_Primitive( const T* data, T value, int count, int incr )
+{
+    for(int i = 0; i < count; i++, data += incr)
+    {
+        if(*data == value) return i;
+    }
+
+    return -1;
+}
+
+//
+// Capacity for a growing collection: doubles, but adds at most COLLECTION_GROWTH_MAX elements at a time.
+//
+CLR_INT32 CLR_RT_HeapBlock_Array::GrowCapacity( CLR_INT32 capacity, CLR_INT32 min )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    CLR_INT32 growth = capacity;
+
+    if(growth > COLLECTION_GROWTH_MAX) growth = COLLECTION_GROWTH_MAX;
+    if(growth < 1                    ) growth = 1;
+
+    capacity += growth;
+
+    if(capacity < min) capacity = min;
+
+    return capacity;
+}
+
 /*
     This is not the same functionality as System.Array.IndexOf.  CLR_RT_HeapBlock_Array::IndexOf does the search analogous
     to calling Object.ReferenceEquals, not Object.Equals, as System.Array.IndexOf demands.  This function is used by
@@ -200,46 +231,53 @@ HRESULT CLR_RT_HeapBlock_Array::IndexOf( CLR_RT_HeapBlock_Array* array, CLR_RT_H
 
             if(matchPtr->DataType() <= DATATYPE_LAST_PRIMITIVE)
             {
-                int incrElem = incr * sizeElem;
+                const CLR_RT_HeapBlock::CLR_RT_HeapBlock_AtomicData::Numeric& num = matchPtr->NumericByRefConst();
+                int                                                            found;
 
-                while(true)
+                //
+                // The element is compared against the low 'sizeElem' bytes of the match, on either endianness.
+                //
+                switch(sizeElem)
                 {
-#if !defined(BIG_ENDIAN)
-                    if(memcmp( data, &matchPtr->NumericByRef(), sizeElem ) == 0)
+                case 1:
+                    if(fForward)
                     {
-                        index = pos;
-                        TINYCLR_SET_AND_LEAVE(S_OK);
+                        const CLR_UINT8* ptr = (const CLR_UINT8*)memchr( data, num.u1, count );
+
+                        found = ptr ? (int)(ptr - data) : -1;
                     }
-#else
-					CLR_UINT64 refNum;
-
-                    switch(sizeElem)
-					{
-					case 1:
-						refNum = matchPtr->NumericByRef().u1;
-						break;
-					case 2:
-						refNum = matchPtr->NumericByRef().u2;
-						break;
-					case 4:
-						refNum = matchPtr->NumericByRef().u4;
-						break;
-					case 8:
-						refNum = matchPtr->NumericByRef().u8;
-						break;
-					}
-					if(memcmp( data, &refNum, sizeElem ) == 0)
-					{
-                        index = pos;
-                        TINYCLR_SET_AND_LEAVE(S_OK);
+                    else
+                    {
+                        found = IndexOf_Primitive( (const CLR_UINT8*)data, num.u1, count, incr );
                     }
-#endif
+                    break;
 
+                case 2: found = IndexOf_Primitive( (const CLR_UINT16*)data, num.u2, count, incr ); break;
+                case 4: found = IndexOf_Primitive( (const CLR_UINT32*)data, num.u4, count, incr ); break;
 
-                    if(--count == 0) break;
+                default:
+                    {
+                        //
+                        // 8-byte elements are only guaranteed 4-byte alignment, so compare them bytewise.
+                        //
+                        CLR_UINT64 refNum   = (CLR_UINT64)num.u8;
+                        int        incrElem = incr * sizeElem;
+                        int        i;
+
+                        for(i = 0; i < count; i++, data += incrElem)
+                        {
+                            if(memcmp( data, &refNum, sizeElem ) == 0) break;
+                        }
+
+                        found = (i < count) ? i : -1;
+                    }
+                    break;
+                }
 
-                    pos  += incr;
-                    data += incrElem;
+                if(found >= 0)
+                {
+                    index = pos + found * incr;
+                    TINYCLR_SET_AND_LEAVE(S_OK);
                 }
             }
         }
@@ -301,7 +339,11 @@ HRESULT CLR_RT_HeapBlock_Array::Copy( CLR_RT_HeapBlock_Array* arraySrc, int inde
             dataSrc += indexSrc * sizeElem;
             dataDst += indexDst * sizeElem;
 
-            if(!arraySrc->m_fReference)
+            //
+            // Primitive elements, and references to objects, are copied as raw blocks.
+            // Only arrays of structs need the per-element deep copy done by Reassign.
+            //
+            if(!arraySrc->m_fReference || arraySrc->m_typeOfElement != DATATYPE_VALUETYPE)
             {
                 memmove( dataDst, dataSrc, length * sizeElem );
             }
@@ -337,6 +379,21 @@ HRESULT CLR_RT_HeapBlock_Array::Copy( CLR_RT_HeapBlock_Array* arraySrc, int inde
             
             TINYCLR_CHECK_HRESULT(descDst.InitializeFromObject( *arrayDst )); descDst.GetElementType( descDst );
 
+            //
+            // When every element of the source is known to fit the destination, check the types once for the whole copy.
+            //
+            if(arraySrc->m_typeOfElement != DATATYPE_VALUETYPE && arrayDst->m_typeOfElement != DATATYPE_VALUETYPE)
+            {
+                TINYCLR_CHECK_HRESULT(descSrc.InitializeFromObject( *arraySrc )); descSrc.GetElementType( descSrc );
+
+                if(CLR_RT_ExecutionEngine::IsInstanceOf( descSrc, descDst ))
+                {
+                    memmove( ptrDst, ptrSrc, length * sizeof(CLR_RT_HeapBlock) );
+
+                    TINYCLR_SET_AND_LEAVE(S_OK);
+                }
+            }
+
             for(int i=0; i<length; i++, ptrSrc++, ptrDst++)
             {
                 if(ptrSrc->DataType() == DATATYPE_OBJECT && ptrSrc->Dereference() == NULL)
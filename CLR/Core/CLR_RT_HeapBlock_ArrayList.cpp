@@ -79,45 +79,85 @@ HRESULT CLR_RT_HeapBlock_ArrayList::Insert( CLR_INT32 index, CLR_RT_HeapBlock* v
     NATIVE_PROFILE_CLR_CORE();
     TINYCLR_HEADER();
 
-    CLR_RT_HeapBlock_Array* items    = GetItems();
-    CLR_INT32               size     = GetSize();
-    CLR_INT32               capacity = items->m_numOfElements;
+    // Protect value from GC, in case MakeRoom triggers one
+    CLR_RT_HeapBlock valueHB; valueHB.SetObjectReference( value );
+    CLR_RT_ProtectFromGC gc( valueHB );
 
-    if(index < 0 || index > size) TINYCLR_SET_AND_LEAVE(CLR_E_OUT_OF_RANGE);
+    TINYCLR_CHECK_HRESULT(MakeRoom( index, 1 ));
 
-    if(size == capacity)
-    {
-        // Protect value from GC, in case EnsureCapacity triggers one
-        CLR_RT_HeapBlock valueHB; valueHB.SetObjectReference( value );
-        CLR_RT_ProtectFromGC gc( valueHB );
-        
-        TINYCLR_CHECK_HRESULT(EnsureCapacity( size + 1, capacity ));
+    ((CLR_RT_HeapBlock*)GetItems()->GetElement( index ))->SetObjectReference( value );
+    
+    TINYCLR_NOCLEANUP();
+}
 
-        // needs to update the reference to the new array
-        items = GetItems();
-    }
+HRESULT CLR_RT_HeapBlock_ArrayList::RemoveAt( CLR_INT32 index )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    TINYCLR_HEADER();
 
-    if(index < size)
+    if(index < 0 || index >= GetSize()) TINYCLR_SET_AND_LEAVE(CLR_E_OUT_OF_RANGE);
+
+    TINYCLR_SET_AND_LEAVE(RemoveRange( index, 1 ));
+    
+    TINYCLR_NOCLEANUP();
+}
+
+// May Trigger GC, but parameter source will be protected
+HRESULT CLR_RT_HeapBlock_ArrayList::AddRange( CLR_RT_HeapBlock_Array* source, CLR_INT32 start, CLR_INT32 count )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    TINYCLR_HEADER();
+
+    TINYCLR_SET_AND_LEAVE(InsertRange( GetSize(), source, start, count ));
+
+    TINYCLR_NOCLEANUP();
+}
+
+// May Trigger GC, but parameter source will be protected
+HRESULT CLR_RT_HeapBlock_ArrayList::InsertRange( CLR_INT32 index, CLR_RT_HeapBlock_Array* source, CLR_INT32 start, CLR_INT32 count )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    TINYCLR_HEADER();
+
+    FAULT_ON_NULL(source);
+
+    if(CLR_RT_HeapBlock_Array::CheckRange( start, count, source->m_numOfElements ) == false) TINYCLR_SET_AND_LEAVE(CLR_E_OUT_OF_RANGE);
+
+    if(count > 0)
     {
-        // Move everything up one slot.
-        CLR_RT_HeapBlock* current = (CLR_RT_HeapBlock*)items->GetElement( size  );
-        CLR_RT_HeapBlock* end     = (CLR_RT_HeapBlock*)items->GetElement( index );
+        // Protect source from GC, in case MakeRoom triggers one
+        CLR_RT_HeapBlock sourceHB; sourceHB.SetObjectReference( source );
+        CLR_RT_ProtectFromGC gc( sourceHB );
+
+        CLR_RT_HeapBlock_Array* items;
+        CLR_INT32               before;
 
-        do
+        TINYCLR_CHECK_HRESULT(MakeRoom( index, count ));
+
+        source = sourceHB.DereferenceArray();
+        items  = GetItems();
+
+        //
+        // Inserting the list into itself: the part of the range past 'index' has just moved up by 'count'.
+        //
+        if(source == items)
         {
-            current->Assign( *(current - 1) );
+            before = index - start;
+
+            if(before < 0    ) before = 0;
+            if(before > count) before = count;
+
+            TINYCLR_CHECK_HRESULT(CLR_RT_HeapBlock_Array::Copy( items, start                  , items, index         , before         ));
+            TINYCLR_SET_AND_LEAVE(CLR_RT_HeapBlock_Array::Copy( items, start + before + count, items, index + before, count - before ));
         }
-        while(--current != end);
-    }
 
-    ((CLR_RT_HeapBlock*)items->GetElement( index ))->SetObjectReference( value );
+        TINYCLR_SET_AND_LEAVE(CLR_RT_HeapBlock_Array::Copy( source, start, items, index, count ));
+    }
 
-    SetSize( size + 1 );
-    
     TINYCLR_NOCLEANUP();
 }
 
-HRESULT CLR_RT_HeapBlock_ArrayList::RemoveAt( CLR_INT32 index )
+HRESULT CLR_RT_HeapBlock_ArrayList::RemoveRange( CLR_INT32 index, CLR_INT32 count )
 {
     NATIVE_PROFILE_CLR_CORE();
     TINYCLR_HEADER();
@@ -125,27 +165,55 @@ HRESULT CLR_RT_HeapBlock_ArrayList::RemoveAt( CLR_INT32 index )
     CLR_RT_HeapBlock_Array* items = GetItems();
     CLR_INT32               size  = GetSize();
 
-    if(index < 0 || index >= size) TINYCLR_SET_AND_LEAVE(CLR_E_OUT_OF_RANGE);
+    if(CLR_RT_HeapBlock_Array::CheckRange( index, count, size ) == false) TINYCLR_SET_AND_LEAVE(CLR_E_OUT_OF_RANGE);
 
-    // Need to shift everything, if it's not the last item
-    if(index < size - 1)
+    if(count > 0)
     {
-        // Move everything down one slot.
-        CLR_RT_HeapBlock* current = (CLR_RT_HeapBlock*)items->GetElement( index    );
-        CLR_RT_HeapBlock* end     = (CLR_RT_HeapBlock*)items->GetElement( size - 1 );
-
-        do
+        // Need to shift everything, if it's not the tail of the list
+        if(index + count < size)
         {
-            current->Assign( *(current + 1) );
+            memmove( items->GetElement( index ), items->GetElement( index + count ), (size - index - count) * sizeof(CLR_RT_HeapBlock) );
         }
-        while(++current != end);
+
+        size -= count;
+
+        TINYCLR_CHECK_HRESULT(items->ClearElements( size, count ));
+
+        SetSize( size );
     }
+    
+    TINYCLR_NOCLEANUP();
+}
 
-    size--;
+// May Trigger GC
+HRESULT CLR_RT_HeapBlock_ArrayList::MakeRoom( CLR_INT32 index, CLR_INT32 count )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    TINYCLR_HEADER();
+
+    CLR_RT_HeapBlock_Array* items    = GetItems();
+    CLR_INT32               size     = GetSize();
+    CLR_INT32               capacity = items->m_numOfElements;
+
+    if(index < 0 || index > size) TINYCLR_SET_AND_LEAVE(CLR_E_OUT_OF_RANGE);
+
+    if(size + count > capacity)
+    {
+        TINYCLR_CHECK_HRESULT(EnsureCapacity( size + count, capacity ));
 
-    ((CLR_RT_HeapBlock*)items->GetElement( size ))->SetObjectReference( NULL );
+        // needs to update the reference to the new array
+        items = GetItems();
+    }
+
+    if(index < size)
+    {
+        // Move everything up 'count' slots, in one block.
+        memmove( items->GetElement( index + count ), items->GetElement( index ), (size - index) * sizeof(CLR_RT_HeapBlock) );
+    }
+
+    TINYCLR_CHECK_HRESULT(items->ClearElements( index, count ));
 
-    SetSize( size );
+    SetSize( size + count );
     
     TINYCLR_NOCLEANUP();
 }
@@ -194,11 +262,7 @@ HRESULT CLR_RT_HeapBlock_ArrayList::EnsureCapacity( CLR_INT32 min, CLR_INT32 cur
 
     if(currentCapacity < min)
     {
-        CLR_INT32 newCapacity = currentCapacity * 3 / 2;
-
-        if(newCapacity < min) newCapacity = min;
-
-        TINYCLR_SET_AND_LEAVE(SetCapacity( newCapacity ));
+        TINYCLR_SET_AND_LEAVE(SetCapacity( CLR_RT_HeapBlock_Array::GrowCapacity( currentCapacity, min ) ));
     }
     
     TINYCLR_NOCLEANUP();
@@ -206,6 +206,159 @@ HRESULT CLR_RT_HeapBlock_Lock::DecrementOwnership( CLR_RT_HeapBlock_Lock* lock,
     TINYCLR_NOCLEANUP();
 }
 
+//--//
+
+CLR_RT_HeapBlock* CLR_RT_HeapBlock_Lock::ThinLock_GetHeader( CLR_RT_HeapBlock& resource )
+{
+    NATIVE_PROFILE_CLR_CORE();
+
+    if(resource.DataType() == DATATYPE_OBJECT)
+    {
+        CLR_RT_HeapBlock* ptr = resource.Dereference();
+
+        if(ptr)
+        {
+            switch(ptr->DataType())
+            {
+                case DATATYPE_VALUETYPE:
+                case DATATYPE_CLASS    :
+                    return ptr;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+static CLR_UINT32 ThinLock_Owner( CLR_RT_Thread* th )
+{
+    return ((CLR_UINT32)th->m_pid & CLR_RT_HeapBlock::c_ThinLock_OwnerMask) << CLR_RT_HeapBlock::c_ThinLock_OwnerShift;
+}
+
+static CLR_RT_SubThread* ThinLock_BaseSubThread( CLR_RT_Thread* th )
+{
+    return (CLR_RT_SubThread*)th->m_subThreads.FirstValidNode();
+}
+
+static CLR_RT_Thread* ThinLock_FindOwner( CLR_RT_DblLinkedList& threads, CLR_UINT32 owner )
+{
+    TINYCLR_FOREACH_NODE(CLR_RT_Thread,th,threads)
+    {
+        if(ThinLock_Owner( th ) == owner) return th;
+    }
+    TINYCLR_FOREACH_NODE_END();
+
+    return NULL;
+}
+
+bool CLR_RT_HeapBlock_Lock::ThinLock_TryEnter( CLR_RT_HeapBlock* obj, CLR_RT_SubThread* sth )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    CLR_RT_Thread* th   = sth->m_owningThread;
+    size_t         word = obj->ObjectLockWord();
+
+    //
+    // Only the base subthread can own a thin lock, constrained subthreads need a real owner record.
+    //
+    if(sth != ThinLock_BaseSubThread( th )) return false;
+
+    if(word == 0)
+    {
+        obj->SetObjectLockWord( ThinLock_Owner( th ) | CLR_RT_HeapBlock::c_ThinLock_RecursionUnit | CLR_RT_HeapBlock::c_ThinLock_Flag );
+        return true;
+    }
+
+    if((word & CLR_RT_HeapBlock::c_ThinLock_Flag) == 0) return false;
+
+    if((word & ~(CLR_RT_HeapBlock::c_ThinLock_RecursionMask | CLR_RT_HeapBlock::c_ThinLock_Flag)) != ThinLock_Owner( th )) return false;
+
+    //
+    // Recursion count saturated, let the caller inflate the lock.
+    //
+    if((word & CLR_RT_HeapBlock::c_ThinLock_RecursionMask) == CLR_RT_HeapBlock::c_ThinLock_RecursionMask) return false;
+
+    obj->SetObjectLockWord( word + CLR_RT_HeapBlock::c_ThinLock_RecursionUnit );
+    return true;
+}
+
+bool CLR_RT_HeapBlock_Lock::ThinLock_TryExit( CLR_RT_HeapBlock* obj, CLR_RT_SubThread* sth )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    CLR_RT_Thread* th   = sth->m_owningThread;
+    size_t         word = obj->ObjectLockWord();
+
+    if((word & CLR_RT_HeapBlock::c_ThinLock_Flag) == 0) return false;
+
+    if(sth != ThinLock_BaseSubThread( th )) return false;
+
+    if((word & ~(CLR_RT_HeapBlock::c_ThinLock_RecursionMask | CLR_RT_HeapBlock::c_ThinLock_Flag)) != ThinLock_Owner( th )) return false;
+
+    if((word & CLR_RT_HeapBlock::c_ThinLock_RecursionMask) == CLR_RT_HeapBlock::c_ThinLock_RecursionUnit)
+    {
+        obj->SetObjectLockWord( 0 );
+    }
+    else
+    {
+        obj->SetObjectLockWord( word - CLR_RT_HeapBlock::c_ThinLock_RecursionUnit );
+    }
+
+    return true;
+}
+
+HRESULT CLR_RT_HeapBlock_Lock::ThinLock_Inflate( CLR_RT_HeapBlock* obj, CLR_RT_HeapBlock& resource, CLR_RT_HeapBlock_Lock*& lock )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    TINYCLR_HEADER();
+
+    size_t                        word = obj->ObjectLockWord();
+    CLR_UINT32                    ownerId;
+    CLR_RT_Thread*                th;
+    CLR_RT_HeapBlock_Lock::Owner* owner;
+
+    if((word & CLR_RT_HeapBlock::c_ThinLock_Flag) == 0)
+    {
+        lock = (CLR_RT_HeapBlock_Lock*)word;
+        TINYCLR_SET_AND_LEAVE(S_OK);
+    }
+
+    lock    = NULL;
+    ownerId = (CLR_UINT32)word & ~(CLR_RT_HeapBlock::c_ThinLock_RecursionMask | CLR_RT_HeapBlock::c_ThinLock_Flag);
+
+    th = ThinLock_FindOwner( g_CLR_RT_ExecutionEngine.m_threadsReady, ownerId );
+    if(th == NULL)
+    {
+        th = ThinLock_FindOwner( g_CLR_RT_ExecutionEngine.m_threadsWaiting, ownerId );
+    }
+
+    if(th == NULL)
+    {
+        //
+        // The owner terminated without releasing the object, same as an abandoned inflated lock.
+        //
+        obj->SetObjectLockWord( 0 );
+        TINYCLR_SET_AND_LEAVE(S_OK);
+    }
+
+    owner = EVENTCACHE_EXTRACT_NODE(g_CLR_RT_EventCache,Owner,DATATYPE_LOCK_OWNER_HEAD); CHECK_ALLOCATION(owner);
+
+    owner->m_owningSubThread = ThinLock_BaseSubThread( th );
+    owner->m_recursion       = (word & CLR_RT_HeapBlock::c_ThinLock_RecursionMask) / CLR_RT_HeapBlock::c_ThinLock_RecursionUnit;
+
+    if(FAILED(hr = CreateInstance( lock, th, resource )))
+    {
+        g_CLR_RT_EventCache.Append_Node( owner );
+
+        lock = NULL;
+        TINYCLR_LEAVE();
+    }
+
+    lock->m_owners.LinkAtFront( owner );
+
+    TINYCLR_NOCLEANUP();
+}
+
+//--//
+
 void CLR_RT_HeapBlock_Lock::Relocate()
 {
     NATIVE_PROFILE_CLR_CORE();
@@ -51,13 +51,13 @@ HRESULT CLR_RT_HeapBlock_Queue::Enqueue( CLR_RT_HeapBlock* value )
         CLR_RT_HeapBlock valueHB; valueHB.SetObjectReference( value );
         CLR_RT_ProtectFromGC gc( valueHB );
 
-        capacity *= 2;
+        capacity = CLR_RT_HeapBlock_Array::GrowCapacity( capacity, size + 1 );
 
         TINYCLR_CHECK_HRESULT(CLR_RT_HeapBlock_Array::CreateInstance( newArrayHB, capacity, g_CLR_RT_WellKnownTypes.m_Object ));
 
         array = newArrayHB.DereferenceArray();
 
-        CopyTo( array, 0 );
+        TINYCLR_CHECK_HRESULT(CopyTo( array, 0 ));
 
         tail = size;
 
@@ -122,7 +122,7 @@ HRESULT CLR_RT_HeapBlock_Queue::ObjArrayMemcpy( CLR_RT_HeapBlock_Array* arraySrc
 {
     TINYCLR_HEADER();
 
-    memcpy( arraySrc->GetElement( indexSrc ), arrayDst->GetElement( indexDst ), length * sizeof(CLR_RT_HeapBlock) );
+    memcpy( arrayDst->GetElement( indexDst ), arraySrc->GetElement( indexSrc ), length * sizeof(CLR_RT_HeapBlock) );
 
     TINYCLR_NOCLEANUP_NOLABEL();
 }
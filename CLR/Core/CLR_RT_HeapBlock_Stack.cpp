@@ -47,13 +47,13 @@ HRESULT CLR_RT_HeapBlock_Stack::Push( CLR_RT_HeapBlock* value )
         CLR_RT_HeapBlock valueHB; valueHB.SetObjectReference( value );
         CLR_RT_ProtectFromGC gc( valueHB );
 
-        capacity *= 2;
+        capacity = CLR_RT_HeapBlock_Array::GrowCapacity( capacity, size + 1 );
 
         TINYCLR_CHECK_HRESULT(CLR_RT_HeapBlock_Array::CreateInstance( newArrayHB, capacity, g_CLR_RT_WellKnownTypes.m_Object ));
 
         newArray = newArrayHB.DereferenceArray();
 
-        memcpy( newArray->GetElement( size ), array->GetFirstElement(), size * sizeof(CLR_RT_HeapBlock) );
+        memcpy( newArray->GetElement( capacity - size ), array->GetFirstElement(), size * sizeof(CLR_RT_HeapBlock) );
 
         SetArray( newArray ); 
         array = newArray;
@@ -9,7 +9,7 @@
 CLR_RT_HeapBlock_String* CLR_RT_HeapBlock_String::CreateInstance( CLR_RT_HeapBlock& reference, CLR_UINT32 length )
 {
     NATIVE_PROFILE_CLR_CORE();
-    CLR_UINT32               totLength = sizeof(CLR_RT_HeapBlock_String) + length + 1;
+    CLR_UINT32               totLength = sizeof(CLR_RT_HeapBlock_String) + sizeof(CLR_UINT32) + length + 1;
     CLR_RT_HeapBlock_String* str;
 
     reference.SetObjectReference( NULL );
@@ -17,7 +17,8 @@ CLR_RT_HeapBlock_String* CLR_RT_HeapBlock_String::CreateInstance( CLR_RT_HeapBlo
     str = (CLR_RT_HeapBlock_String*)g_CLR_RT_ExecutionEngine.ExtractHeapBytesForObjects( DATATYPE_STRING, 0, totLength );
     if(str)
     {
-        LPSTR szText = (LPSTR)&str[ 1 ]; szText[ 0 ] = 0;
+        CLR_UINT32* hash   = (CLR_UINT32*)&str[ 1 ]; hash  [ 0 ] = 0;
+        LPSTR       szText = (LPSTR)&hash[ 1 ];      szText[ 0 ] = 0;
 
 #if defined(TINYCLR_NO_ASSEMBLY_STRINGS)
         str->SetStringText( szText );
@@ -105,6 +106,26 @@ HRESULT CLR_RT_HeapBlock_String::CreateInstance( CLR_RT_HeapBlock& reference, CL
     TINYCLR_NOCLEANUP();
 }
 
+//
+// The text cannot change once the string is visible to managed code, so the hash is computed on first use and kept.
+//
+CLR_UINT32 CLR_RT_HeapBlock_String::HashCode()
+{
+    NATIVE_PROFILE_CLR_CORE();
+    CLR_UINT32* slot = HashSlot();
+    CLR_UINT32  crc;
+    LPCSTR      szText;
+
+    if(slot && *slot) return *slot;
+
+    szText = StringText();
+    crc    = SUPPORT_ComputeCRC( szText, (int)hal_strlen_s( szText ), 0 );
+
+    if(slot) *slot = crc;
+
+    return crc;
+}
+
 CLR_RT_HeapBlock_String* CLR_RT_HeapBlock_String::GetStringEmpty()
 {
     return g_CLR_RT_TypeSystem.m_assemblyMscorlib->GetStaticField( Library_corlib_native_System_String::FIELD_STATIC__Empty )->DereferenceString(); 
@@ -73,12 +73,30 @@ void CLR_RT_HeapBlock_Timer::Trigger()
     NATIVE_PROFILE_CLR_CORE();
     if(m_references.IsEmpty()) return;
     
-    if(m_flags & CLR_RT_HeapBlock_Timer::c_Executing)
+    if(m_flags & (CLR_RT_HeapBlock_Timer::c_Executing | CLR_RT_HeapBlock_Timer::c_Triggered))
     {        
         return;
     }
 
     m_flags |= CLR_RT_HeapBlock_Timer::c_Triggered;
+
+    //
+    // Queue the timer behind every timer due at or before it, so timers sharing a due tick stay together, in FIFO order.
+    //
+    CLR_RT_DblLinkedList&  queue = g_CLR_RT_ExecutionEngine.m_timersTriggered;
+    CLR_RT_HeapBlock_Node* prev  = queue.Head();
+
+    TINYCLR_FOREACH_NODE_BACKWARD(CLR_RT_HeapBlock_Timer,timer,queue)
+    {
+        if(timer->m_timeExpire <= m_timeExpire)
+        {
+            prev = timer;
+            break;
+        }
+    }
+    TINYCLR_FOREACH_NODE_BACKWARD_END();
+
+    queue.InsertAfterNode( prev, this );
 }
 
 void CLR_RT_HeapBlock_Timer::SpawnTimer( CLR_RT_Thread* th )
@@ -94,15 +112,32 @@ void CLR_RT_HeapBlock_Timer::SpawnTimer( CLR_RT_Thread* th )
     CLR_RT_HeapBlock_Delegate*   delegate     = callback->DereferenceDelegate();
     CLR_RT_ProtectFromGC         gc( *managedTimer );
 
-    _ASSERTE(delegate != NULL);  if(delegate == NULL) return;
+    _ASSERTE(delegate != NULL);
+    if(delegate == NULL)
+    {
+        //
+        // Nothing to call, so the timer can't fire again; drop it from the run queue.
+        //
+        m_flags      &= ~CLR_RT_HeapBlock_Timer::c_Triggered;
+        m_timeExpire  = TIMEOUT_INFINITE;
+        return;
+    }
     _ASSERTE(delegate->DataType() == DATATYPE_DELEGATE_HEAD);
 
+    CLR_INT64 now     = (m_flags & CLR_RT_HeapBlock_Timer::c_AbsoluteTimer) ? g_CLR_RT_ExecutionEngine.m_currentLocalTime : g_CLR_RT_ExecutionEngine.m_currentMachineTime;
+    CLR_INT64 latency = (m_timeExpire != TIMEOUT_INFINITE && now > m_timeExpire) ? now - m_timeExpire : 0;
+
     m_ticksLastExpiration = g_CLR_RT_ExecutionEngine.m_currentMachineTime;
     m_timeLastExpiration  = m_timeExpire;
     m_timeExpire          = TIMEOUT_INFINITE;
 
     if(SUCCEEDED(th->PushThreadProcDelegate( delegate )))
     {
+        g_CLR_RT_ExecutionEngine.m_timerDispatches++;
+        g_CLR_RT_ExecutionEngine.m_timerLatencyTotal += latency;
+
+        if(latency > g_CLR_RT_ExecutionEngine.m_timerLatencyMax) g_CLR_RT_ExecutionEngine.m_timerLatencyMax = latency;
+
         CLR_RT_StackFrame* stack = th->FirstFrame();
         if(stack->Next() != NULL)
         {
@@ -122,6 +157,14 @@ void CLR_RT_HeapBlock_Timer::SpawnTimer( CLR_RT_Thread* th )
         th->m_terminationCallback  = CLR_RT_HeapBlock_Timer::ThreadTerminationCallback;
         th->m_terminationParameter = this;
     }
+    else
+    {
+        //
+        // Out of memory for the call: leave the run queue and come due again on the next timer check.
+        //
+        m_flags      &= ~CLR_RT_HeapBlock_Timer::c_Triggered;
+        m_timeExpire  = m_timeLastExpiration; CLR_RT_ExecutionEngine::InvalidateTimerCache();
+    }
 }
 
 void CLR_RT_HeapBlock_Timer::ThreadTerminationCallback( void* param )
@@ -22,17 +22,36 @@ HRESULT CLR_RT_HeapBlock_WaitForObject::CreateInstance( CLR_RT_Thread* caller, c
     //
         
     _ASSERTE( sizeof(CLR_RT_HeapBlock_WaitForObject) % 4 == 0 );
+    _ASSERTE( sizeof(Waiter                        ) % 4 == 0 );
 
-    CLR_UINT32 totLength = (CLR_UINT32)(sizeof(CLR_RT_HeapBlock_WaitForObject) + cObjects * sizeof(CLR_RT_HeapBlock));
+    CLR_UINT32 totLength = (CLR_UINT32)(sizeof(CLR_RT_HeapBlock_WaitForObject) + cObjects * (sizeof(CLR_RT_HeapBlock) + sizeof(Waiter)));
 
     CLR_RT_HeapBlock_WaitForObject* wait = EVENTCACHE_EXTRACT_NODE_AS_BYTES(g_CLR_RT_EventCache,CLR_RT_HeapBlock_WaitForObject,DATATYPE_WAIT_FOR_OBJECT_HEAD,0,totLength); CHECK_ALLOCATION(wait);
     
-    wait->m_timeExpire = timeExpire; CLR_RT_ExecutionEngine::InvalidateTimerCache();
-    wait->m_cObjects   = cObjects;
-    wait->m_fWaitAll   = fWaitAll;
+    wait->m_owningThread = caller;
+    wait->m_timeExpire   = timeExpire; CLR_RT_ExecutionEngine::InvalidateTimerCache();
+    wait->m_cObjects     = cObjects;
+    wait->m_fWaitAll     = fWaitAll;
 
     memcpy( wait->GetWaitForObjects(), objects, sizeof(CLR_RT_HeapBlock) * cObjects );
 
+    //
+    // Register the thread on the queue of each object, so a signal only looks at the threads waiting for it.
+    //
+    {
+        Waiter* waiter = wait->GetWaiters();
+
+        for(CLR_UINT32 i = 0; i < cObjects; i++, waiter++)
+        {
+            waiter->ClearData();
+
+            waiter->m_wait  = wait;
+            waiter->m_index = i;
+
+            WaiterQueue( waiter->Object() ).LinkAtBack( waiter );
+        }
+    }
+
     caller->m_waitForObject        = wait;
     caller->m_status               = CLR_RT_Thread::TH_S_Waiting;
     caller->m_waitForObject_Result = CLR_RT_Thread::TH_WAIT_RESULT_INIT;
@@ -42,20 +61,71 @@ HRESULT CLR_RT_HeapBlock_WaitForObject::CreateInstance( CLR_RT_Thread* caller, c
     TINYCLR_NOCLEANUP();
 }
 
-void CLR_RT_HeapBlock_WaitForObject::TryWaitForSignal( CLR_RT_Thread* th )
+void CLR_RT_HeapBlock_WaitForObject::Release()
 {
     NATIVE_PROFILE_CLR_CORE();
-    CLR_RT_HeapBlock_WaitForObject* wait = th->m_waitForObject;
+    Waiter* waiter = GetWaiters();
 
-    if(wait)
+    for(CLR_UINT32 i = 0; i < m_cObjects; i++, waiter++)
     {
-        if (CLR_RT_HeapBlock_WaitForObject::TryWaitForSignal( th, wait->GetWaitForObjects(), wait->m_cObjects, wait->m_fWaitAll ))
+        waiter->Unlink();
+    }
+
+    g_CLR_RT_EventCache.Append_Node( this );
+}
+
+//--//
+
+CLR_RT_DblLinkedList& CLR_RT_HeapBlock_WaitForObject::WaiterQueue( CLR_RT_HeapBlock* object )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    CLR_UINT32 hash = (CLR_UINT32)(size_t)object / sizeof(CLR_RT_HeapBlock);
+
+    return g_CLR_RT_ExecutionEngine.m_waiterQueues[ hash % c_NumOfWaiterQueues ];
+}
+
+void CLR_RT_HeapBlock_WaitForObject::InitializeWaiterQueues()
+{
+    NATIVE_PROFILE_CLR_CORE();
+    for(CLR_UINT32 i = 0; i < c_NumOfWaiterQueues; i++)
+    {
+        g_CLR_RT_ExecutionEngine.m_waiterQueues[ i ].DblLinkedList_Initialize();
+    }
+}
+
+void CLR_RT_HeapBlock_WaitForObject::RelocateWaiterQueues()
+{
+    NATIVE_PROFILE_CLR_CORE();
+    //
+    // The queues are selected by object address, so after a compaction every waiter has to be requeued.
+    // The wait objects have already been relocated, and each queue keeps the registration order.
+    //
+    CLR_RT_DblLinkedList moved; moved.DblLinkedList_Initialize();
+
+    for(CLR_UINT32 i = 0; i < c_NumOfWaiterQueues; i++)
+    {
+        CLR_RT_DblLinkedList& queue = g_CLR_RT_ExecutionEngine.m_waiterQueues[ i ];
+
+        TINYCLR_FOREACH_NODE(Waiter,waiter,queue)
         {
-            th->Restart( true );
+            if(&WaiterQueue( waiter->Object() ) != &queue)
+            {
+                moved.LinkAtBack( waiter );
+            }
         }
+        TINYCLR_FOREACH_NODE_END();
+    }
+
+    while(true)
+    {
+        Waiter* waiter = (Waiter*)moved.ExtractFirstNode(); if(!waiter) break;
+
+        WaiterQueue( waiter->Object() ).LinkAtBack( waiter );
     }
 }
 
+//--//
+
 bool CLR_RT_HeapBlock_WaitForObject::TryWaitForSignal(CLR_RT_Thread* caller, CLR_RT_HeapBlock* objects, CLR_UINT32 cObjects, bool fWaitAll)
 {
     NATIVE_PROFILE_CLR_CORE();
@@ -125,19 +195,34 @@ bool CLR_RT_HeapBlock_WaitForObject::TryWaitForSignal(CLR_RT_Thread* caller, CLR
 void CLR_RT_HeapBlock_WaitForObject::SignalObject( CLR_RT_HeapBlock& object )
 {
     NATIVE_PROFILE_CLR_CORE();
+    CLR_RT_DblLinkedList& queue = WaiterQueue( &object );
+
     object.SetFlags( CLR_RT_HeapBlock::HB_Signaled );
 
-    TINYCLR_FOREACH_NODE(CLR_RT_Thread,th,g_CLR_RT_ExecutionEngine.m_threadsWaiting)
+    TINYCLR_FOREACH_NODE(Waiter,waiter,queue)
     {
-        CLR_RT_HeapBlock_WaitForObject::TryWaitForSignal( th );
+        if(waiter->Object() != &object) continue;
+
+        CLR_RT_HeapBlock_WaitForObject* wait = waiter->m_wait;
+        CLR_RT_Thread*                  th   = wait->m_owningThread;
 
-        if(!object.IsFlagSet( CLR_RT_HeapBlock::HB_Signaled ))
+        if(CLR_RT_HeapBlock_WaitForObject::TryWaitForSignal( th, wait->GetWaitForObjects(), wait->m_cObjects, wait->m_fWaitAll ))
         {
-            _ASSERTE(object.IsFlagSet( CLR_RT_HeapBlock::HB_SignalAutoReset ));
-            //This is an AutoResetEvent.  Since the event got unsignaled, we can break out of
-            //the loop early, as this object can only free one thread.
-            break;
-        }        
+            //
+            // Restarting the thread releases its wait, which can take more than one entry off this queue.
+            //
+            th->Restart( true );
+
+            if(!object.IsFlagSet( CLR_RT_HeapBlock::HB_Signaled ))
+            {
+                _ASSERTE(object.IsFlagSet( CLR_RT_HeapBlock::HB_SignalAutoReset ));
+                //This is an AutoResetEvent.  Since the event got unsignaled, we can break out of
+                //the loop early, as this object can only free one thread.
+                break;
+            }
+
+            TINYCLR_FOREACH_NODE_RESTART(Waiter,waiter,queue);
+        }
     }
     TINYCLR_FOREACH_NODE_END();
 }
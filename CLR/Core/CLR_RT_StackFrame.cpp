@@ -55,7 +55,35 @@ HRESULT CLR_RT_StackFrame::Push( CLR_RT_Thread* th, const CLR_RT_MethodDef_Insta
 
         memorySize += CONVERTFROMSIZETOHEAPBLOCKS(offsetof(CLR_RT_StackFrame,m_extension));
 
-        stack = EVENTCACHE_EXTRACT_NODE_AS_BLOCKS(g_CLR_RT_EventCache,CLR_RT_StackFrame,DATATYPE_STACK_FRAME,0,memorySize); CHECK_ALLOCATION(stack);
+        //
+        // Reuse a frame recently popped by this thread, if one is close enough in size, before going to the event cache.
+        //
+        stack = NULL;
+
+        TINYCLR_FOREACH_NODE(CLR_RT_StackFrame,frame,th->m_stackFramesFree)
+        {
+            CLR_UINT32 size = frame->DataSize();
+
+            if(size >= memorySize && size <= (memorySize * 20) / 16) // Accept a maximum overhead of 25%.
+            {
+                frame->Unlink();
+
+                frame->ChangeDataType( DATATYPE_STACK_FRAME );
+
+#if defined(TINYCLR_PROFILE_NEW_ALLOCATIONS)
+                g_CLR_PRF_Profiler.TrackObjectCreation( frame );
+#endif
+
+                stack = frame;
+                break;
+            }
+        }
+        TINYCLR_FOREACH_NODE_END();
+
+        if(stack == NULL)
+        {
+            stack = EVENTCACHE_EXTRACT_NODE_AS_BLOCKS(g_CLR_RT_EventCache,CLR_RT_StackFrame,DATATYPE_STACK_FRAME,0,memorySize); CHECK_ALLOCATION(stack);
+        }
     }
 
     //--//
@@ -141,6 +169,9 @@ HRESULT CLR_RT_StackFrame::Push( CLR_RT_Thread* th, const CLR_RT_MethodDef_Insta
 
             stack->m_flags   = CLR_RT_StackFrame::c_MethodKind_Interpreted;
             stack->m_IPstart = assm->GetByteCode( md->RVA );
+#if defined(TINYCLR_QUICKENING)
+            stack->m_IPstart = g_CLR_RT_ExecutionEngine.Quickening_Enter( assm, stack->m_call.Method(), stack->m_IPstart );
+#endif
             stack->m_IP      = stack->m_IPstart;
         }
 
@@ -161,12 +192,48 @@ HRESULT CLR_RT_StackFrame::Push( CLR_RT_Thread* th, const CLR_RT_MethodDef_Insta
 #endif
     }
 
-    if(md->numLocals)
-    {        
-        g_CLR_RT_ExecutionEngine.InitializeLocals( stack->m_locals, assm, md );
+#if defined(TINYCLR_FRAME_TEMPLATES)
+    //
+    // The first call decodes the locals signature into the method's template, later calls just stamp the data types.
+    //
+    CLR_UINT8* tmpl = assm->GetFrameTemplate( stack->m_call.Method() );
+
+    if(tmpl && (tmpl[ 0 ] & c_FrameTemplate_Ready) == 0)
+    {
+        if(FAILED(g_CLR_RT_ExecutionEngine.InitializeFrameTemplate( tmpl, assm, md ))) tmpl = NULL;
     }
 
+    if(tmpl)
     {
+        CLR_UINT8 header = tmpl[ 0 ];
+
+        if(header & c_FrameTemplate_SlowLocals)
+        {
+            g_CLR_RT_ExecutionEngine.InitializeLocals( stack->m_locals, assm, md );
+        }
+        else
+        {
+            CLR_RT_HeapBlock* locals = stack->m_locals;
+            const CLR_UINT8*  dt     = &tmpl[ 1 ];
+
+            for(CLR_UINT32 num = sizeLocals; num > 0; num--, locals++, dt++)
+            {
+                locals->SetDataId( CLR_RT_HEAPBLOCK_RAW_ID(*dt,CLR_RT_HeapBlock::HB_Alive,1) );
+                locals->ClearData();
+            }
+        }
+
+        if(header & c_FrameTemplate_Synchronized) stack->m_flags |= c_NeedToSynchronize;
+        if(header & c_FrameTemplate_SyncGlobally) stack->m_flags |= c_NeedToSynchronizeGlobally;
+    }
+    else
+#endif
+    {
+        if(md->numLocals)
+        {        
+            g_CLR_RT_ExecutionEngine.InitializeLocals( stack->m_locals, assm, md );
+        }
+
         CLR_UINT32 flags = md->flags & (md->MD_Synchronized | md->MD_GloballySynchronized);
 
         if(flags)
@@ -842,7 +909,30 @@ void CLR_RT_StackFrame::Pop()
         }
     }
     
-    g_CLR_RT_EventCache.Append_Node( this );
+    //
+    // Keep a few frames on the owning thread for the next Push, the rest go back to the event cache.
+    //
+    CLR_RT_Thread* th = m_owningThread;
+
+    if(th->m_stackFramesFree.NumOfNodes() < c_MaxCachedFrames)
+    {
+        ChangeDataType( DATATYPE_CACHEDBLOCK );
+
+        Debug_ClearBlock( 0xAB );
+
+        th->m_stackFramesFree.LinkAtFront( this );
+
+        //
+        // Parked frames are reported like frames returned to the event cache, so the profiler sees one allocation per Push either way.
+        //
+#if defined(TINYCLR_PROFILE_NEW_ALLOCATIONS)
+        g_CLR_PRF_Profiler.TrackObjectDeletion( this );
+#endif
+    }
+    else
+    {
+        g_CLR_RT_EventCache.Append_Node( this );
+    }
 }
 
 //--//
@@ -12,6 +12,18 @@
 
 #define UTF8_LOAD_LOWPART(ch,ch2,src) ch = (CLR_UINT32)*src++; ch2 <<= 6; ch2 |=  (ch & 0x3F)
 
+//
+// True if none of the four bytes in the word has the high bit set or is zero, i.e. four plain ASCII characters.
+//
+#define UTF8_ASCII_WORD(w) (((w) & 0x80808080) == 0 && (((w) - 0x01010101) & ~(w) & 0x80808080) == 0)
+
+//
+// Same test for a word holding two UTF-16 characters.
+//
+#define UTF16_ASCII_WORD(w) (((w) & 0xFF80FF80) == 0 && ((w) & 0x0000FFFF) != 0 && ((w) & 0xFFFF0000) != 0)
+
+#define UTF8_WORD_ALIGNED(src) (((size_t)(src) & (sizeof(CLR_UINT32) - 1)) == 0)
+
 //--//
 
 int CLR_RT_UnicodeHelper::CountNumberOfCharacters( int max )
@@ -22,6 +34,20 @@ int CLR_RT_UnicodeHelper::CountNumberOfCharacters( int max )
 
     while(true)
     {
+        if(UTF8_WORD_ALIGNED(pSrc) && (max < 0 || max >= 4))
+        {
+            CLR_UINT32 w = *(const CLR_UINT32*)pSrc;
+
+            if(UTF8_ASCII_WORD(w))
+            {
+                pSrc += 4;
+                num  += 4;
+
+                if(max > 0) max -= 4;
+                continue;
+            }
+        }
+
         CLR_UINT32 ch = (CLR_UINT32)*pSrc++; if(!ch) break;
 
         if(max-- == 0) break; // This works even if you pass -1 as argument (it will walk through the whole string).
@@ -80,6 +106,20 @@ int CLR_RT_UnicodeHelper::CountNumberOfBytes( int max )
 
     while(true)
     {
+        if(UTF8_WORD_ALIGNED(pSrc) && (max < 0 || max >= 2))
+        {
+            CLR_UINT32 w = *(const CLR_UINT32*)pSrc;
+
+            if(UTF16_ASCII_WORD(w))
+            {
+                pSrc += 2;
+                num  += 2;
+
+                if(max > 0) max -= 2;
+                continue;
+            }
+        }
+
         CLR_UINT16 ch = *pSrc++; if(!ch) break;
 
         if(max-- == 0) break; // This works even if you pass -1 as argument (it will walk through the whole string).
@@ -118,6 +158,33 @@ int CLR_RT_UnicodeHelper::CountNumberOfBytes( int max )
     return num;
 }
 
+int CLR_RT_UnicodeHelper::CountLeadingASCII( const CLR_UINT8* src, int max )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    const CLR_UINT8* pSrc = src;
+    const CLR_UINT8* pEnd = src + max;
+
+    while(pSrc < pEnd)
+    {
+        if(UTF8_WORD_ALIGNED(pSrc) && pEnd - pSrc >= 4)
+        {
+            CLR_UINT32 w = *(const CLR_UINT32*)pSrc;
+
+            if(UTF8_ASCII_WORD(w))
+            {
+                pSrc += 4;
+                continue;
+            }
+        }
+
+        if(*pSrc == 0 || *pSrc >= 0x80) break;
+
+        pSrc++;
+    }
+
+    return (int)(pSrc - src);
+}
+
 //--//
 
 bool CLR_RT_UnicodeHelper::ConvertFromUTF8( int iMaxChars, bool fJustMove, int iMaxBytes )
@@ -137,6 +204,33 @@ bool CLR_RT_UnicodeHelper::ConvertFromUTF8( int iMaxChars, bool fJustMove, int i
 
     while(iMaxChars > 0 && iMaxBytes > 0)
     {
+        //
+        // Runs of ASCII text are moved a word at a time; anything else, including the terminator, takes the slow path below.
+        //
+        if(iMaxChars >= 4 && iMaxBytes >= 4 && UTF8_WORD_ALIGNED(inputUTF8) && (fJustMove || outputUTF16_size >= 4))
+        {
+            CLR_UINT32 w = *(const CLR_UINT32*)inputUTF8;
+
+            if(UTF8_ASCII_WORD(w))
+            {
+                if(fJustMove == false)
+                {
+                    outputUTF16[ 0 ] = inputUTF8[ 0 ];
+                    outputUTF16[ 1 ] = inputUTF8[ 1 ];
+                    outputUTF16[ 2 ] = inputUTF8[ 2 ];
+                    outputUTF16[ 3 ] = inputUTF8[ 3 ];
+
+                    outputUTF16      += 4;
+                    outputUTF16_size -= 4;
+                }
+
+                inputUTF8 += 4;
+                iMaxChars -= 4;
+                iMaxBytes -= 4;
+                continue;
+            }
+        }
+
         ch = (CLR_UINT32)*inputUTF8++;
 
         switch(ch & 0xF0)
@@ -323,6 +417,27 @@ bool CLR_RT_UnicodeHelper::ConvertToUTF8( int iMaxChars, bool fJustMove )
 
     while(iMaxChars > 0)
     {
+        if(iMaxChars >= 2 && UTF8_WORD_ALIGNED(inputUTF16) && (fJustMove || outputUTF8_size >= 2))
+        {
+            CLR_UINT32 w = *(const CLR_UINT32*)inputUTF16;
+
+            if(UTF16_ASCII_WORD(w))
+            {
+                if(fJustMove == false)
+                {
+                    outputUTF8[ 0 ] = (CLR_UINT8)inputUTF16[ 0 ];
+                    outputUTF8[ 1 ] = (CLR_UINT8)inputUTF16[ 1 ];
+
+                    outputUTF8      += 2;
+                    outputUTF8_size -= 2;
+                }
+
+                inputUTF16 += 2;
+                iMaxChars  -= 2;
+                continue;
+            }
+        }
+
         ch = (CLR_UINT32)*inputUTF16++;
 
         if(ch < 0x0080)
@@ -53,11 +53,13 @@ HRESULT CLR_RT_ExecutionEngine::ExecutionEngine_Initialize()
     m_weakReferences.DblLinkedList_Initialize();    // CLR_RT_DblLinkedList                m_weakReferences;
                                                     //
     m_timers        .DblLinkedList_Initialize();    // CLR_RT_DblLinkedList                m_timers;
+    m_timersTriggered.DblLinkedList_Initialize();   // CLR_RT_DblLinkedList                m_timersTriggered;
     m_raisedEvents  = 0;                            // CLR_UINT32                          m_raisedEvents;
                                                     //
     m_threadsReady  .DblLinkedList_Initialize();    // CLR_RT_DblLinkedList                m_threadsReady;
     m_threadsWaiting.DblLinkedList_Initialize();    // CLR_RT_DblLinkedList                m_threadsWaiting;
     m_threadsZombie .DblLinkedList_Initialize();    // CLR_RT_DblLinkedList                m_threadsZombie;
+    CLR_RT_HeapBlock_WaitForObject::InitializeWaiterQueues(); // CLR_RT_DblLinkedList          m_waiterQueues[];
                                                     // int                                 m_lastPid;
                                                     //
     m_finalizersAlive  .DblLinkedList_Initialize(); // CLR_RT_DblLinkedList                m_finalizersAlive;
@@ -83,6 +85,34 @@ HRESULT CLR_RT_ExecutionEngine::ExecutionEngine_Initialize()
 #endif
 
     m_interruptThread     = NULL;                   // CLR_RT_Thread                       m_interruptThread;
+    TINYCLR_CLEAR(m_timerThreads);                  // CLR_RT_Thread*                      m_timerThreads[];
+                                                    //
+    m_timerDispatches     = 0;                      // CLR_UINT32                          m_timerDispatches;
+    m_timerThreadsReused  = 0;                      // CLR_UINT32                          m_timerThreadsReused;
+    m_timerLatencyTotal   = 0;                      // CLR_INT64                           m_timerLatencyTotal;
+    m_timerLatencyMax     = 0;                      // CLR_INT64                           m_timerLatencyMax;
+                                                    //
+#if defined(TINYCLR_BOXING_CACHE)
+    TINYCLR_CLEAR(m_boxCacheBoolean);               // CLR_RT_HeapBlock*                   m_boxCacheBoolean[];
+    TINYCLR_CLEAR(m_boxCacheChar);                  // CLR_RT_HeapBlock*                   m_boxCacheChar[];
+    TINYCLR_CLEAR(m_boxCacheUInt8);                 // CLR_RT_HeapBlock*                   m_boxCacheUInt8[];
+    TINYCLR_CLEAR(m_boxCacheInt16);                 // CLR_RT_HeapBlock*                   m_boxCacheInt16[];
+    TINYCLR_CLEAR(m_boxCacheInt32);                 // CLR_RT_HeapBlock*                   m_boxCacheInt32[];
+    m_boxCacheHits        = 0;                      // CLR_UINT32                          m_boxCacheHits;
+    m_boxAllocations      = 0;                      // CLR_UINT32                          m_boxAllocations;
+#endif
+                                                    //
+#if defined(TINYCLR_QUICKENING)
+    TINYCLR_CLEAR(m_quickened);                     // CLR_RT_QuickenedMethod*             m_quickened[];
+    m_quickenedBytes      = 0;                      // CLR_UINT32                          m_quickenedBytes;
+    m_quickenedClock      = 0;                      // CLR_UINT32                          m_quickenedClock;
+    m_quickenedEvictions  = 0;                      // CLR_UINT32                          m_quickenedEvictions;
+#endif
+                                                    //
+#if defined(TINYCLR_PROFILE_OPCODES)
+    TINYCLR_CLEAR(m_opcodeCounts);                  // CLR_UINT32                          m_opcodeCounts[];
+    TINYCLR_CLEAR(m_superInstructionCounts);        // CLR_UINT32                          m_superInstructionCounts[];
+#endif
                                                     //
 #if defined(TINYCLR_JITTER)
                                                     // const FLASH_SECTOR*                 m_jitter_firstSector;
@@ -101,6 +131,7 @@ HRESULT CLR_RT_ExecutionEngine::ExecutionEngine_Initialize()
     m_appDomains.DblLinkedList_Initialize();        // CLR_RT_DblLinkedList                m_appDomains;
     
     m_appDomainCurrent = NULL;                      // CLR_AppDomainCurrent*               m_appDomainCurrent;    
+    m_appDomainStaticFields = NULL;                 // CLR_RT_HeapBlock**                  m_appDomainStaticFields;
     m_appDomainIdNext  = c_AppDomainId_Invalid + 1; // int                                 m_appDomainIdNext;
 #endif
 
@@ -135,6 +166,8 @@ HRESULT CLR_RT_ExecutionEngine::ExecutionEngine_Initialize()
 
 #if defined(TINYCLR_APPDOMAINS)
     TINYCLR_CHECK_HRESULT(CLR_RT_AppDomain::CreateInstance( "default", m_appDomainCurrent ));
+
+    m_appDomainStaticFields = m_appDomainCurrent->m_staticFields;
 #endif
 
     UpdateTime();
@@ -272,7 +305,7 @@ void CLR_RT_ExecutionEngine::ExecutionEngine_Cleanup()
     m_finalizerThread = NULL;
     m_cctorThread = NULL;
 
-    m_timerThread = NULL;
+    TINYCLR_CLEAR(m_timerThreads);
 
     AbortAllThreads  ( m_threadsReady   );
     AbortAllThreads  ( m_threadsWaiting );
@@ -281,6 +314,10 @@ void CLR_RT_ExecutionEngine::ExecutionEngine_Cleanup()
     ReleaseAllThreads( m_threadsWaiting );
     ReleaseAllThreads( m_threadsZombie  );
 
+#if defined(TINYCLR_QUICKENING)
+    Quickening_Cleanup();
+#endif
+
     g_CLR_RT_TypeSystem.TypeSystem_Cleanup();
     g_CLR_RT_EventCache.EventCache_Cleanup();
 
@@ -458,9 +495,15 @@ void CLR_RT_ExecutionEngine::Relocate()
 
     CLR_RT_GarbageCollector::Heap_Relocate( (void**)&m_currentUICulture     );
 
+#if defined(TINYCLR_BOXING_CACHE)
+    BoxCache_Relocate();
+#endif
+
     m_weakReferences.Relocate();
 
     g_CLR_RT_Persistence_Manager.Relocate();
+
+    CLR_RT_HeapBlock_WaitForObject::RelocateWaiterQueues();
 }
 
 //--//
@@ -786,23 +829,33 @@ bool CLR_RT_ExecutionEngine::EnsureSystemThread( CLR_RT_Thread*& thread, int pri
 void CLR_RT_ExecutionEngine::SpawnTimer()
 {
     NATIVE_PROFILE_CLR_CORE();
-    TINYCLR_FOREACH_NODE(CLR_RT_HeapBlock_Timer,timer,m_timers)
+
+    //
+    // The run queue is sorted by due time, so timers that expired on the same tick sit next to each other
+    // and get handed out to the idle workers in a single pass.
+    //
+    for(int i = 0; i < c_NumOfTimerThreads; i++)
     {
-        if(timer->m_flags & CLR_RT_HeapBlock_Timer::c_Triggered)
-        {               
-            if(EnsureSystemThread( m_timerThread, ThreadPriority::Normal ))
-            {
-                //only fire one timer at a time
+        CLR_RT_HeapBlock_Timer* timer = (CLR_RT_HeapBlock_Timer*)m_timersTriggered.FirstValidNode();
+        CLR_RT_Thread*          th;
 
-                timer->SpawnTimer( m_timerThread );
+        if(timer == NULL) break;
 
-                //put at the back of the queue to allow for fairness of the timers.
-                m_timers.LinkAtBack( timer );
-            }
-            break;
-        }
+        th = m_timerThreads[ i ];
+
+        if(EnsureSystemThread( m_timerThreads[ i ], ThreadPriority::Normal ) == false) continue;
+
+        if(th != NULL) m_timerThreadsReused++;
+
+        timer->SpawnTimer( m_timerThreads[ i ] );
+
+        //
+        // Back on the main list, behind the other timers, to allow for fairness.
+        // A timer that could not be dispatched has cleared its trigger, so it leaves the run queue too
+        // instead of holding up the timers behind it.
+        //
+        m_timers.LinkAtBack( timer );
     }
-    TINYCLR_FOREACH_NODE_END();
 }
 
 void CLR_RT_ExecutionEngine::StaticConstructorTerminationCallback( void* arg )
@@ -1422,7 +1475,7 @@ void CLR_RT_ExecutionEngine::InsertThreadRoundRobin( CLR_RT_DblLinkedList& threa
 
     if(thTarget->m_waitForObject != NULL)
     {
-        g_CLR_RT_EventCache.Append_Node( thTarget->m_waitForObject );
+        thTarget->m_waitForObject->Release();
                     
         thTarget->m_waitForObject = NULL;
     }
@@ -1684,11 +1737,14 @@ CLR_RT_HeapBlock* CLR_RT_ExecutionEngine::AccessStaticField( const CLR_RT_FieldD
     {
 #if defined(TINYCLR_APPDOMAINS)        
         {
-            CLR_RT_AppDomainAssembly* appDomainAssembly = g_CLR_RT_ExecutionEngine.GetCurrentAppDomain()->FindAppDomainAssembly( inst.m_assm );
+            //
+            // One lookup in the table of the current AppDomain, instead of walking its assemblies.
+            //
+            CLR_RT_HeapBlock* staticFields = g_CLR_RT_ExecutionEngine.m_appDomainStaticFields[ inst.m_assm->m_idx - 1 ];
 
-            if(appDomainAssembly)
+            if(staticFields)
             {
-                return &appDomainAssembly->m_pStaticFields[ inst.CrossReference().m_offset ];
+                return &staticFields[ inst.CrossReference().m_offset ];
             }
         }
 #else
@@ -1765,96 +1821,109 @@ HRESULT CLR_RT_ExecutionEngine::InitializeReference( CLR_RT_HeapBlock& ref, cons
 
 //--//
 
-HRESULT CLR_RT_ExecutionEngine::InitializeLocals( CLR_RT_HeapBlock* locals, CLR_RT_Assembly* assm, const CLR_RECORD_METHODDEF* md )
+HRESULT CLR_RT_ExecutionEngine::ParseLocal( CLR_PMETADATA& sig, CLR_RT_Assembly* assm, CLR_DataType& dt, CLR_DataType& dtModifier, CLR_RT_TypeDef_Index& cls, CLR_UINT32& levels )
 {
     NATIVE_PROFILE_CLR_CORE();
-    //
-    // WARNING!!!
-    //
-    // This method is a shortcut for the following code:
-    //
-  
     TINYCLR_HEADER();
 
-    CLR_PMETADATA sig     = assm->GetSignature( md->locals );
-    CLR_UINT32    count   = md->numLocals;
-    bool          fZeroed = false;
+    dt         = DATATYPE_VOID;
+    dtModifier = DATATYPE_VOID;
+    levels     = 0;
 
-    while(count)
+    while(true)
     {
-        CLR_DataType         dt = DATATYPE_VOID;
-        CLR_RT_TypeDef_Index cls;
-        CLR_UINT32           levels = 0;
-        CLR_DataType         dtModifier = DATATYPE_VOID;
+        dt = CLR_UncompressElementType( sig );
 
-        while(true)
+        switch(dt)
         {
-            dt = CLR_UncompressElementType( sig );
+        case DATATYPE_TYPE_PINNED :
+            dtModifier = DATATYPE_TYPE_PINNED;
+            break;
+            
+        // Array declared on stack        .locals init [0] int16[] foo, 
+        case DATATYPE_SZARRAY:
+        // Reference declared on stack - .locals init [1] int16& pinned pShort,
+        case DATATYPE_BYREF:
+            levels++;
+            break;
 
-            switch(dt)
+        case DATATYPE_CLASS:
+        case DATATYPE_VALUETYPE:
             {
-            case DATATYPE_TYPE_PINNED :
-                dtModifier = DATATYPE_TYPE_PINNED;
-                break;
-                
-            // Array declared on stack        .locals init [0] int16[] foo, 
-            case DATATYPE_SZARRAY:
-            // Reference declared on stack - .locals init [1] int16& pinned pShort,
-            case DATATYPE_BYREF:
-                levels++;
-                break;
+                CLR_UINT32 tk  = CLR_TkFromStream( sig );
+                CLR_UINT32 idx = CLR_DataFromTk( tk );
 
-            case DATATYPE_CLASS:
-            case DATATYPE_VALUETYPE:
+                switch(CLR_TypeFromTk( tk ))
                 {
-                    CLR_UINT32 tk  = CLR_TkFromStream( sig );
-                    CLR_UINT32 idx = CLR_DataFromTk( tk );
-
-                    switch(CLR_TypeFromTk( tk ))
+                case TBL_TypeSpec:
                     {
-                    case TBL_TypeSpec:
-                        {
-                            CLR_RT_SignatureParser          sub; sub.Initialize_TypeSpec( assm, assm->GetTypeSpec( idx ) );
-                            CLR_RT_SignatureParser::Element res;
-
-                            TINYCLR_CHECK_HRESULT(sub.Advance( res ));
+                        CLR_RT_SignatureParser          sub; sub.Initialize_TypeSpec( assm, assm->GetTypeSpec( idx ) );
+                        CLR_RT_SignatureParser::Element res;
 
-                            cls     = res.m_cls;
-                            levels += res.m_levels;
-                        }
-                        break;
+                        TINYCLR_CHECK_HRESULT(sub.Advance( res ));
 
-                    case TBL_TypeRef:
-                        cls = assm->m_pCrossReference_TypeRef[ idx ].m_target;
-                        break;
+                        cls     = res.m_cls;
+                        levels += res.m_levels;
+                    }
+                    break;
 
-                    case TBL_TypeDef:
-                        cls.Set( assm->m_idx, idx );
-                        break;
+                case TBL_TypeRef:
+                    cls = assm->m_pCrossReference_TypeRef[ idx ].m_target;
+                    break;
 
-                    default:
-                        TINYCLR_SET_AND_LEAVE(CLR_E_WRONG_TYPE);
-                    }
+                case TBL_TypeDef:
+                    cls.Set( assm->m_idx, idx );
+                    break;
 
+                default:
+                    TINYCLR_SET_AND_LEAVE(CLR_E_WRONG_TYPE);
                 }
-                goto done;
 
-            default:
-                {
-                    const CLR_RT_TypeDef_Index* cls2 = c_CLR_RT_DataTypeLookup[ dt ].m_cls;
+            }
+            TINYCLR_SET_AND_LEAVE(S_OK);
 
-                    if(cls2 == NULL)
-                    {
-                        TINYCLR_SET_AND_LEAVE(CLR_E_WRONG_TYPE);
-                    }
+        default:
+            {
+                const CLR_RT_TypeDef_Index* cls2 = c_CLR_RT_DataTypeLookup[ dt ].m_cls;
 
-                    cls = *cls2;
+                if(cls2 == NULL)
+                {
+                    TINYCLR_SET_AND_LEAVE(CLR_E_WRONG_TYPE);
                 }
-                goto done;
+
+                cls = *cls2;
             }
+            TINYCLR_SET_AND_LEAVE(S_OK);
         }
+    }
+
+    TINYCLR_NOCLEANUP();
+}
+
+HRESULT CLR_RT_ExecutionEngine::InitializeLocals( CLR_RT_HeapBlock* locals, CLR_RT_Assembly* assm, const CLR_RECORD_METHODDEF* md )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    //
+    // WARNING!!!
+    //
+    // This method is a shortcut for the following code:
+    //
+  
+    TINYCLR_HEADER();
+
+    CLR_PMETADATA sig     = assm->GetSignature( md->locals );
+    CLR_UINT32    count   = md->numLocals;
+    bool          fZeroed = false;
+
+    while(count)
+    {
+        CLR_DataType         dt;
+        CLR_RT_TypeDef_Index cls;
+        CLR_UINT32           levels;
+        CLR_DataType         dtModifier;
+
+        TINYCLR_CHECK_HRESULT(ParseLocal( sig, assm, dt, dtModifier, cls, levels ));
 
-done:
         if(levels > 0) // Array or reference
         {
             locals->SetObjectReference( NULL );
@@ -1917,6 +1986,403 @@ done:
     TINYCLR_NOCLEANUP();
 }
 
+#if defined(TINYCLR_FRAME_TEMPLATES)
+
+HRESULT CLR_RT_ExecutionEngine::InitializeFrameTemplate( CLR_UINT8* tmpl, CLR_RT_Assembly* assm, const CLR_RECORD_METHODDEF* md )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    TINYCLR_HEADER();
+
+    //
+    // Same decoding as InitializeLocals, but only records the data type each local starts with.
+    // Locals that need more than that (value types to allocate, pinned references) send the method back to InitializeLocals.
+    //
+    CLR_PMETADATA sig    = assm->GetSignature( md->locals );
+    CLR_UINT8     header = CLR_RT_StackFrame::c_FrameTemplate_Ready;
+    CLR_UINT8*    dst    = &tmpl[ 1 ];
+
+    for(CLR_UINT32 count = md->numLocals; count > 0; count--, dst++)
+    {
+        CLR_DataType         dt;
+        CLR_RT_TypeDef_Index cls;
+        CLR_UINT32           levels;
+        CLR_DataType         dtModifier;
+
+        TINYCLR_CHECK_HRESULT(ParseLocal( sig, assm, dt, dtModifier, cls, levels ));
+
+        if(levels > 0)
+        {
+            if(dtModifier == DATATYPE_TYPE_PINNED) header |= CLR_RT_StackFrame::c_FrameTemplate_SlowLocals;
+
+            dt = DATATYPE_OBJECT;
+        }
+        else if(dt == DATATYPE_VALUETYPE)
+        {
+            CLR_RT_TypeDef_Instance inst; inst.InitializeFromIndex( cls );
+
+            if(inst.m_target->dataType == DATATYPE_VALUETYPE) header |= CLR_RT_StackFrame::c_FrameTemplate_SlowLocals;
+
+            dt = (CLR_DataType)inst.m_target->dataType;
+        }
+        else if(c_CLR_RT_DataTypeLookup[ dt ].m_flags & CLR_RT_DataTypeLookup::c_Reference)
+        {
+            dt = DATATYPE_OBJECT;
+        }
+
+        *dst = (CLR_UINT8)dt;
+    }
+
+    if(md->flags & CLR_RECORD_METHODDEF::MD_Synchronized        ) header |= CLR_RT_StackFrame::c_FrameTemplate_Synchronized;
+    if(md->flags & CLR_RECORD_METHODDEF::MD_GloballySynchronized) header |= CLR_RT_StackFrame::c_FrameTemplate_SyncGlobally;
+
+    tmpl[ 0 ] = header;
+
+    TINYCLR_NOCLEANUP();
+}
+
+#endif
+
+//--//
+
+#if defined(TINYCLR_QUICKENING)
+
+//
+// Walks the byte code in [ipStart,ipEnd) and counts the ldfld/stfld that can use the quick opcodes.
+// If 'code' is not NULL, it's a copy of the same byte range and the sites are rewritten in it.
+//
+static int Quickening_Rewrite( CLR_RT_Assembly* assm, CLR_PMETADATA ipStart, CLR_PMETADATA ipEnd, CLR_UINT8* code )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    CLR_PMETADATA ip    = ipStart;
+    int           sites = 0;
+
+    while(ip < ipEnd)
+    {
+        CLR_PMETADATA ipOp = ip;
+        CLR_OPCODE    op   = CLR_ReadNextOpcodeCompressed( ip );
+
+        if(op == CEE_LDFLD || op == CEE_STFLD)
+        {
+            CLR_PMETADATA ipArg = ip;
+
+            FETCH_ARG_COMPRESSED_FIELDTOKEN(arg,ipArg);
+
+            CLR_RT_FieldDef_Instance inst;
+
+            if(inst.ResolveToken( arg, assm ) && (inst.m_target->flags & CLR_RECORD_FIELDDEF::FD_Static) == 0)
+            {
+                if(code)
+                {
+                    CLR_UINT8* dst    = &code[ ipOp - ipStart ];
+                    CLR_UINT16 offset = inst.CrossReference().m_offset;
+
+                    //
+                    // Same length as the original instruction, so branch targets and handler offsets don't move.
+                    //
+                    dst[ 0 ] = (CLR_UINT8)(op == CEE_LDFLD ? CEE_LDFLD_QUICK : CEE_STFLD_QUICK);
+
+                    memcpy( &dst[ 1 ], &offset, sizeof(offset) );
+                }
+
+                sites++;
+            }
+        }
+
+        ip = CLR_SkipBodyOfOpcodeCompressed( ip, op );
+    }
+
+    return sites;
+}
+
+static bool Quickening_InUse_Threads( CLR_RT_DblLinkedList& threads, CLR_RT_QuickenedMethod* qm )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    TINYCLR_FOREACH_NODE(CLR_RT_Thread,th,threads)
+    {
+        TINYCLR_FOREACH_NODE(CLR_RT_StackFrame,stack,th->m_stackFrames)
+        {
+            if(stack->m_IPstart == qm->m_code) return true;
+        }
+        TINYCLR_FOREACH_NODE_END();
+    }
+    TINYCLR_FOREACH_NODE_END();
+
+    return false;
+}
+
+//
+// Called by CLR_RT_StackFrame::Push for every interpreted call.
+// Returns the byte code the frame should run: the quickened copy if there is one, the original otherwise.
+//
+CLR_PMETADATA CLR_RT_ExecutionEngine::Quickening_Enter( CLR_RT_Assembly* assm, CLR_IDX method, CLR_PMETADATA ipStart )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    CLR_RT_MethodDef_CrossReference& mdCR = assm->m_pCrossReference_MethodDef[ method ];
+
+    if(mdCR.m_quickSlot)
+    {
+        CLR_RT_QuickenedMethod* qm = m_quickened[ mdCR.m_quickSlot - 1 ];
+
+        qm->m_lastUsed = ++m_quickenedClock;
+
+        return qm->m_code;
+    }
+
+    if(mdCR.m_quickCalls == c_QuickeningNever) return ipStart;
+
+    if(++mdCR.m_quickCalls < c_QuickeningThreshold) return ipStart;
+
+    CLR_RT_QuickenedMethod* qm = Quickening_Method( assm, method, ipStart );
+
+    return qm ? qm->m_code : ipStart;
+}
+
+CLR_RT_QuickenedMethod* CLR_RT_ExecutionEngine::Quickening_Method( CLR_RT_Assembly* assm, CLR_IDX method, CLR_PMETADATA ipStart )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    CLR_RT_MethodDef_CrossReference& mdCR = assm->m_pCrossReference_MethodDef[ method ];
+    const CLR_RECORD_METHODDEF*      md   = assm->GetMethodDef( method );
+    CLR_RT_QuickenedMethod*          qm;
+    CLR_PMETADATA                    ipEnd;
+    CLR_OFFSET                       start;
+    CLR_OFFSET                       end;
+    CLR_UINT32                       size;
+    int                              slot;
+
+    if(assm->FindMethodBoundaries( method, start, end ) == false)
+    {
+        mdCR.m_quickCalls = c_QuickeningNever; return NULL;
+    }
+
+    //
+    // The copy covers the whole method, exception handler table included, so that the interpreter can find the handlers relative to m_IPstart.
+    //
+    size  = end - start;
+    ipEnd = ipStart + size;
+
+    if(md->flags & CLR_RECORD_METHODDEF::MD_HasExceptionHandlers)
+    {
+        const CLR_RECORD_EH* ptrEh;
+        CLR_UINT32           numEh;
+
+        ipEnd = CLR_RECORD_EH::ExtractEhFromByteCode( ipEnd, ptrEh, numEh );
+    }
+
+    if(size > QUICKENING_BUDGET / 4 || Quickening_Rewrite( assm, ipStart, ipEnd, NULL ) == 0)
+    {
+        mdCR.m_quickCalls = c_QuickeningNever; return NULL;
+    }
+
+    while(true)
+    {
+        for(slot = 0; slot < c_QuickenedSlots; slot++)
+        {
+            if(m_quickened[ slot ] == NULL) break;
+        }
+
+        if(slot < c_QuickenedSlots && m_quickenedBytes + size <= QUICKENING_BUDGET) break;
+
+        //
+        // Every quickened method is on some stack right now, try again after a few more calls.
+        //
+        if(Quickening_Evict() == false)
+        {
+            mdCR.m_quickCalls = 0; return NULL;
+        }
+    }
+
+    //
+    // Quickening is optional, never start a garbage collection for it.
+    //
+    qm = (CLR_RT_QuickenedMethod*)CLR_RT_Memory::Allocate( offsetof(CLR_RT_QuickenedMethod,m_code) + size, CLR_RT_HeapBlock::HB_NoGcOnFailedAllocation );
+    if(qm == NULL)
+    {
+        mdCR.m_quickCalls = 0; return NULL;
+    }
+
+    qm->m_md.Set( assm->m_idx, method );
+    qm->m_lastUsed = ++m_quickenedClock;
+    qm->m_size     = size;
+
+    memcpy( qm->m_code, ipStart, size );
+
+    Quickening_Rewrite( assm, ipStart, ipEnd, qm->m_code );
+
+    m_quickened[ slot ]  = qm;
+    m_quickenedBytes    += size;
+
+    mdCR.m_quickSlot = (CLR_UINT8)(slot + 1);
+
+    return qm;
+}
+
+bool CLR_RT_ExecutionEngine::Quickening_InUse( CLR_RT_QuickenedMethod* qm )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    //
+    // Every thread list, not just the runnable ones: a suspended or zombie thread's frames may still point into the copy.
+    //
+    return Quickening_InUse_Threads( m_threadsReady, qm ) || Quickening_InUse_Threads( m_threadsWaiting, qm ) || Quickening_InUse_Threads( m_threadsZombie, qm );
+}
+
+bool CLR_RT_ExecutionEngine::Quickening_Evict()
+{
+    NATIVE_PROFILE_CLR_CORE();
+    int victim = -1;
+
+    for(int slot = 0; slot < c_QuickenedSlots; slot++)
+    {
+        CLR_RT_QuickenedMethod* qm = m_quickened[ slot ];
+
+        if(qm == NULL || Quickening_InUse( qm )) continue;
+
+        if(victim < 0 || (CLR_INT32)(qm->m_lastUsed - m_quickened[ victim ]->m_lastUsed) < 0)
+        {
+            victim = slot;
+        }
+    }
+
+    if(victim < 0) return false;
+
+    Quickening_Free( victim );
+
+    m_quickenedEvictions++;
+
+    return true;
+}
+
+void CLR_RT_ExecutionEngine::Quickening_Free( int slot )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    CLR_RT_QuickenedMethod*   qm = m_quickened[ slot ];
+    CLR_RT_MethodDef_Instance inst;
+
+    if(inst.InitializeFromIndex( qm->m_md ))
+    {
+        CLR_RT_MethodDef_CrossReference& mdCR = inst.CrossReference();
+
+        mdCR.m_quickSlot  = 0;
+        mdCR.m_quickCalls = 0;
+    }
+
+    m_quickenedBytes    -= qm->m_size;
+    m_quickened[ slot ]  = NULL;
+
+    CLR_RT_Memory::Release( qm );
+}
+
+//
+// A quick opcode found a receiver it can't handle (value type, proxy, byref).
+// Puts the original instruction back, so the site goes through the regular path from now on.
+//
+void CLR_RT_ExecutionEngine::Quickening_Deoptimize( CLR_RT_StackFrame* stack, CLR_PMETADATA ip )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    CLR_RT_Assembly* assm   = stack->m_call.m_assm;
+    CLR_PMETADATA    ipOrig = assm->GetByteCode( stack->m_call.m_target->RVA ) + (ip - stack->m_IPstart);
+
+    memcpy( (CLR_UINT8*)ip, ipOrig, 1 + sizeof(CLR_UINT16) );
+}
+
+void CLR_RT_ExecutionEngine::Quickening_Cleanup()
+{
+    NATIVE_PROFILE_CLR_CORE();
+    for(int slot = 0; slot < c_QuickenedSlots; slot++)
+    {
+        if(m_quickened[ slot ]) Quickening_Free( slot );
+    }
+
+    m_quickenedBytes = 0;
+}
+
+#endif
+
+//--//
+
+#if defined(TINYCLR_BOXING_CACHE)
+
+//
+// Returns the cache entry for boxing 'value' as 'cls', or NULL if the value is not cacheable.
+// Enums and other types sharing the same data type never match, so a cached box always has the exact requested type.
+//
+CLR_RT_HeapBlock** CLR_RT_ExecutionEngine::BoxCache_Slot( const CLR_RT_TypeDef_Instance& cls, const CLR_RT_HeapBlock& value )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    CLR_DataType                dt      = value.DataType();
+    CLR_DataType                dtBox   = (CLR_DataType)cls.m_target->dataType;
+    const CLR_RT_HeapBlock::CLR_RT_HeapBlock_AtomicData::Numeric& num = value.NumericByRefConst();
+    bool                        fStack  = (dt == DATATYPE_I4);
+
+    //
+    // Values come either promoted from the evaluation stack or with their own data type.
+    //
+    if(!fStack && dt != dtBox) return NULL;
+
+    switch(dtBox)
+    {
+    case DATATYPE_BOOLEAN:
+        if(cls.m_data == g_CLR_RT_WellKnownTypes.m_Boolean.m_data)
+        {
+            CLR_UINT32 v = fStack ? num.u4 : num.u1;
+
+            if(v < 2) return &m_boxCacheBoolean[ v ];
+        }
+        break;
+
+    case DATATYPE_CHAR:
+        if(cls.m_data == g_CLR_RT_WellKnownTypes.m_Char.m_data)
+        {
+            CLR_UINT32 v = fStack ? num.u4 : num.u2;
+
+            if(v < ARRAYSIZE(m_boxCacheChar)) return &m_boxCacheChar[ v ];
+        }
+        break;
+
+    case DATATYPE_U1:
+        if(cls.m_data == g_CLR_RT_WellKnownTypes.m_UInt8.m_data)
+        {
+            CLR_UINT32 v = fStack ? num.u4 : num.u1;
+
+            if(v < ARRAYSIZE(m_boxCacheUInt8)) return &m_boxCacheUInt8[ v ];
+        }
+        break;
+
+    case DATATYPE_I2:
+        if(cls.m_data == g_CLR_RT_WellKnownTypes.m_Int16.m_data)
+        {
+            CLR_INT32 v = fStack ? num.s4 : num.s2;
+
+            if(v >= BOXING_CACHE_MIN && v <= BOXING_CACHE_MAX) return &m_boxCacheInt16[ v - BOXING_CACHE_MIN ];
+        }
+        break;
+
+    case DATATYPE_I4:
+        if(cls.m_data == g_CLR_RT_WellKnownTypes.m_Int32.m_data)
+        {
+            CLR_INT32 v = num.s4;
+
+            if(v >= BOXING_CACHE_MIN && v <= BOXING_CACHE_MAX) return &m_boxCacheInt32[ v - BOXING_CACHE_MIN ];
+        }
+        break;
+    }
+
+    return NULL;
+}
+
+void CLR_RT_ExecutionEngine::BoxCache_Relocate()
+{
+    NATIVE_PROFILE_CLR_CORE();
+    int i;
+
+    for(i = 0; i < ARRAYSIZE(m_boxCacheBoolean); i++) CLR_RT_GarbageCollector::Heap_Relocate( (void**)&m_boxCacheBoolean[ i ] );
+    for(i = 0; i < ARRAYSIZE(m_boxCacheChar   ); i++) CLR_RT_GarbageCollector::Heap_Relocate( (void**)&m_boxCacheChar   [ i ] );
+    for(i = 0; i < ARRAYSIZE(m_boxCacheUInt8  ); i++) CLR_RT_GarbageCollector::Heap_Relocate( (void**)&m_boxCacheUInt8  [ i ] );
+    for(i = 0; i < ARRAYSIZE(m_boxCacheInt16  ); i++) CLR_RT_GarbageCollector::Heap_Relocate( (void**)&m_boxCacheInt16  [ i ] );
+    for(i = 0; i < ARRAYSIZE(m_boxCacheInt32  ); i++) CLR_RT_GarbageCollector::Heap_Relocate( (void**)&m_boxCacheInt32  [ i ] );
+}
+
+#endif
+
 //--//
 
 HRESULT CLR_RT_ExecutionEngine::NewObjectFromIndex( CLR_RT_HeapBlock& reference, const CLR_RT_TypeDef_Index& cls )
@@ -2427,28 +2893,36 @@ void CLR_RT_ExecutionEngine::ProcessTimeEvent( CLR_UINT32 event )
     NATIVE_PROFILE_CLR_CORE();
     SYSTEMTIME systemTime;
 
+    CLR_RT_DblLinkedList* lists[] = { &m_timers, &m_timersTriggered };
+
     UpdateTime();
 
     Time_ToSystemTime( m_currentLocalTime, &systemTime );
 
-    TINYCLR_FOREACH_NODE(CLR_RT_HeapBlock_Timer,timer,m_timers)
+    //
+    // Timers waiting in the run queue for a worker still follow the clock, Trigger leaves them queued.
+    //
+    for(int i = 0; i < ARRAYSIZE(lists); i++)
     {
-        if(timer->m_flags & CLR_RT_HeapBlock_Timer::c_EnabledTimer)
+        TINYCLR_FOREACH_NODE(CLR_RT_HeapBlock_Timer,timer,*lists[ i ])
         {
-            CLR_UINT32 val = timer->m_flags & CLR_RT_HeapBlock_Timer::c_AnyChange;
-
-            if(val)
+            if(timer->m_flags & CLR_RT_HeapBlock_Timer::c_EnabledTimer)
             {
-                timer->AdjustNextFixedExpire( systemTime, true );
+                CLR_UINT32 val = timer->m_flags & CLR_RT_HeapBlock_Timer::c_AnyChange;
 
-                if(val == event && (timer->m_flags & CLR_RT_HeapBlock_Timer::c_Recurring) == 0)
+                if(val)
                 {
-                    timer->Trigger();
+                    timer->AdjustNextFixedExpire( systemTime, true );
+
+                    if(val == event && (timer->m_flags & CLR_RT_HeapBlock_Timer::c_Recurring) == 0)
+                    {
+                        timer->Trigger();
+                    }
                 }
             }
         }
+        TINYCLR_FOREACH_NODE_END();
     }
-    TINYCLR_FOREACH_NODE_END();
 
     SpawnTimer();
 }
@@ -2634,8 +3108,23 @@ HRESULT CLR_RT_ExecutionEngine::LockObject( CLR_RT_HeapBlock& reference, CLR_RT_
     TINYCLR_HEADER();
 
     CLR_RT_HeapBlock_Lock* lock;
+    CLR_RT_HeapBlock*      obj = CLR_RT_HeapBlock_Lock::ThinLock_GetHeader( reference );
 
-    lock = FindLockObject( reference );
+    if(obj)
+    {
+        //
+        // Uncontended case, no allocation and no thread scan.
+        //
+        if(CLR_RT_HeapBlock_Lock::ThinLock_TryEnter( obj, sth )) TINYCLR_SET_AND_LEAVE(S_OK);
+
+        TINYCLR_CHECK_HRESULT(CLR_RT_HeapBlock_Lock::ThinLock_Inflate( obj, reference, lock ));
+
+        if(lock == NULL && CLR_RT_HeapBlock_Lock::ThinLock_TryEnter( obj, sth )) TINYCLR_SET_AND_LEAVE(S_OK);
+    }
+    else
+    {
+        lock = FindLockObject( reference );
+    }
     
     if(lock == NULL)
     {
@@ -2653,6 +3142,14 @@ HRESULT CLR_RT_ExecutionEngine::UnlockObject( CLR_RT_HeapBlock& reference, CLR_R
     TINYCLR_HEADER();
 
     CLR_RT_HeapBlock_Lock* lock;
+    CLR_RT_HeapBlock*      obj = CLR_RT_HeapBlock_Lock::ThinLock_GetHeader( reference );
+
+    if(obj && obj->IsObjectThinLocked())
+    {
+        if(CLR_RT_HeapBlock_Lock::ThinLock_TryExit( obj, sth )) TINYCLR_SET_AND_LEAVE(S_OK);
+
+        TINYCLR_SET_AND_LEAVE(CLR_E_LOCK_SYNCHRONIZATION_EXCEPTION);
+    }
 
     lock = FindLockObject( reference );
 
@@ -3460,7 +3957,8 @@ CLR_RT_AppDomain* CLR_RT_ExecutionEngine::SetCurrentAppDomain( CLR_RT_AppDomain*
     NATIVE_PROFILE_CLR_CORE();
     CLR_RT_AppDomain* ad = m_appDomainCurrent; 
 
-    m_appDomainCurrent = appDomain;
+    m_appDomainCurrent      = appDomain;
+    m_appDomainStaticFields = appDomain ? appDomain->m_staticFields : NULL;
 
     return ad;
 }
@@ -3549,22 +4047,26 @@ void CLR_RT_ExecutionEngine::UpdateTime()
 
     if(timeZoneOffset != m_lastTimeZoneOffset)
     {
-        SYSTEMTIME systemTime;
+        SYSTEMTIME            systemTime;
+        CLR_RT_DblLinkedList* lists[] = { &m_timers, &m_timersTriggered };
     
         m_lastTimeZoneOffset = timeZoneOffset;
         Time_ToSystemTime( m_currentLocalTime, &systemTime );
     
-        TINYCLR_FOREACH_NODE(CLR_RT_HeapBlock_Timer,timer,m_timers)
+        for(int i = 0; i < ARRAYSIZE(lists); i++)
         {
-            if(timer->m_flags & CLR_RT_HeapBlock_Timer::c_EnabledTimer)
+            TINYCLR_FOREACH_NODE(CLR_RT_HeapBlock_Timer,timer,*lists[ i ])
             {
-                if(timer->m_flags & CLR_RT_HeapBlock_Timer::c_AnyChange)
+                if(timer->m_flags & CLR_RT_HeapBlock_Timer::c_EnabledTimer)
                 {
-                    timer->AdjustNextFixedExpire( systemTime, false );
+                    if(timer->m_flags & CLR_RT_HeapBlock_Timer::c_AnyChange)
+                    {
+                        timer->AdjustNextFixedExpire( systemTime, false );
+                    }
                 }
             }
+            TINYCLR_FOREACH_NODE_END();
         }
-        TINYCLR_FOREACH_NODE_END();
     }
     
 }
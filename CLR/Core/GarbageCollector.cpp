@@ -157,6 +157,27 @@ CLR_UINT32 CLR_RT_GarbageCollector::ExecuteGarbageCollection()
     }
 #endif
 
+    //
+    // Hand the frames parked on each thread back to the event cache, so the cleanup below can reclaim them.
+    //
+    TINYCLR_FOREACH_NODE(CLR_RT_Thread,th,g_CLR_RT_ExecutionEngine.m_threadsReady)
+    {
+        th->m_stackFramesFree.DblLinkedList_PushToCache();
+    }
+    TINYCLR_FOREACH_NODE_END();
+
+    TINYCLR_FOREACH_NODE(CLR_RT_Thread,th,g_CLR_RT_ExecutionEngine.m_threadsWaiting)
+    {
+        th->m_stackFramesFree.DblLinkedList_PushToCache();
+    }
+    TINYCLR_FOREACH_NODE_END();
+
+    TINYCLR_FOREACH_NODE(CLR_RT_Thread,th,g_CLR_RT_ExecutionEngine.m_threadsZombie)
+    {
+        th->m_stackFramesFree.DblLinkedList_PushToCache();
+    }
+    TINYCLR_FOREACH_NODE_END();
+
     g_CLR_RT_EventCache.EventCache_Cleanup();
 
     Mark    ();
@@ -173,8 +194,58 @@ CLR_UINT32 CLR_RT_GarbageCollector::ExecuteGarbageCollection()
         int milliSec = ((int)::HAL_Time_TicksToTime( HAL_Time_CurrentTicks() - stats_start ) + TIME_CONVERSION__TICKUNITS - 1) / TIME_CONVERSION__TICKUNITS;
 
         CLR_Debug::Printf( "GC: %dmsec %d bytes used, %d bytes available\r\n", milliSec, m_totalBytes - m_freeBytes, m_freeBytes );
+
+        if(g_CLR_RT_ExecutionEngine.m_timerDispatches)
+        {
+            CLR_Debug::Printf( "Timers: %d dispatches, %d on existing workers, latency avg %d usec, max %d usec\r\n",
+                               g_CLR_RT_ExecutionEngine.m_timerDispatches,
+                               g_CLR_RT_ExecutionEngine.m_timerThreadsReused,
+                               (int)(g_CLR_RT_ExecutionEngine.m_timerLatencyTotal / g_CLR_RT_ExecutionEngine.m_timerDispatches / (TIME_CONVERSION__TO_MILLISECONDS / 1000)),
+                               (int)(g_CLR_RT_ExecutionEngine.m_timerLatencyMax                                                / (TIME_CONVERSION__TO_MILLISECONDS / 1000)) );
+        }
+
+#if defined(TINYCLR_QUICKENING)
+        if(g_CLR_RT_ExecutionEngine.m_quickenedBytes || g_CLR_RT_ExecutionEngine.m_quickenedEvictions)
+        {
+            int methods = 0;
+
+            for(int slot = 0; slot < CLR_RT_ExecutionEngine::c_QuickenedSlots; slot++)
+            {
+                if(g_CLR_RT_ExecutionEngine.m_quickened[ slot ]) methods++;
+            }
+
+            CLR_Debug::Printf( "Quickening: %d methods, %d bytes of %d, %d evictions\r\n", methods, g_CLR_RT_ExecutionEngine.m_quickenedBytes, QUICKENING_BUDGET, g_CLR_RT_ExecutionEngine.m_quickenedEvictions );
+        }
+#endif
+
+#if defined(TINYCLR_BOXING_CACHE)
+        if(g_CLR_RT_ExecutionEngine.m_boxCacheHits || g_CLR_RT_ExecutionEngine.m_boxAllocations)
+        {
+            CLR_Debug::Printf( "Boxing cache: %d hits, %d boxes allocated\r\n", g_CLR_RT_ExecutionEngine.m_boxCacheHits, g_CLR_RT_ExecutionEngine.m_boxAllocations );
+        }
+#endif
     }
 
+#if defined(TINYCLR_PROFILE_OPCODES)
+    if(s_CLR_RT_fTrace_MemoryStats >= c_CLR_RT_Trace_Verbose)
+    {
+        for(int op = 0; op < CEE_COUNT; op++)
+        {
+            CLR_UINT32 count = g_CLR_RT_ExecutionEngine.m_opcodeCounts[ op ];
+
+            if(count)
+            {
+                CLR_Debug::Printf( "Opcode %03X %-16s: %u\r\n", op, c_CLR_RT_OpcodeLookup[ op ].Name(), count );
+            }
+        }
+
+        CLR_Debug::Printf( "Super-instructions: load field %u, add constant %u, compare and branch %u\r\n",
+                           g_CLR_RT_ExecutionEngine.m_superInstructionCounts[ CLR_RT_ExecutionEngine::c_SuperInstruction_LoadField     ],
+                           g_CLR_RT_ExecutionEngine.m_superInstructionCounts[ CLR_RT_ExecutionEngine::c_SuperInstruction_AddConstant   ],
+                           g_CLR_RT_ExecutionEngine.m_superInstructionCounts[ CLR_RT_ExecutionEngine::c_SuperInstruction_CompareBranch ] );
+    }
+#endif
+
     if(s_CLR_RT_fTrace_MemoryStats >= c_CLR_RT_Trace_Info)
     {
         int countBlocks[ DATATYPE_FIRST_INVALID ]; TINYCLR_CLEAR(countBlocks);
@@ -348,6 +419,19 @@ void CLR_RT_GarbageCollector::Mark()
 
         CheckSingleBlock_Force( g_CLR_RT_ExecutionEngine.m_currentUICulture );
 
+#if defined(TINYCLR_BOXING_CACHE)
+        {
+            CLR_RT_ExecutionEngine& ee = g_CLR_RT_ExecutionEngine;
+            int                     i;
+
+            for(i = 0; i < ARRAYSIZE(ee.m_boxCacheBoolean); i++) CheckSingleBlock_Force( ee.m_boxCacheBoolean[ i ] );
+            for(i = 0; i < ARRAYSIZE(ee.m_boxCacheChar   ); i++) CheckSingleBlock_Force( ee.m_boxCacheChar   [ i ] );
+            for(i = 0; i < ARRAYSIZE(ee.m_boxCacheUInt8  ); i++) CheckSingleBlock_Force( ee.m_boxCacheUInt8  [ i ] );
+            for(i = 0; i < ARRAYSIZE(ee.m_boxCacheInt16  ); i++) CheckSingleBlock_Force( ee.m_boxCacheInt16  [ i ] );
+            for(i = 0; i < ARRAYSIZE(ee.m_boxCacheInt32  ); i++) CheckSingleBlock_Force( ee.m_boxCacheInt32  [ i ] );
+        }
+#endif
+
 
 #if defined(TINYCLR_VALIDATE_APPDOMAIN_ISOLATION)                    
         (void)g_CLR_RT_ExecutionEngine.SetCurrentAppDomain( NULL );
@@ -751,6 +835,12 @@ void CLR_RT_GarbageCollector::RecoverEventsFromGC()
     }
     TINYCLR_FOREACH_NODE_END();
 
+    TINYCLR_FOREACH_NODE(CLR_RT_HeapBlock_Timer,timer,g_CLR_RT_ExecutionEngine.m_timersTriggered)
+    {
+        timer->RecoverFromGC();
+    }
+    TINYCLR_FOREACH_NODE_END();
+
     //--//
 
     TINYCLR_FOREACH_NODE(CLR_RT_Thread,th,g_CLR_RT_ExecutionEngine.m_threadsReady)
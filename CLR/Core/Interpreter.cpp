@@ -47,6 +47,42 @@ bool g_CLR_RT_fBadStack;
 #define READCACHE(stack,evalPos,ip,fDirty)  { evalPos               = &stack->m_evalStackPos[ -1 ]; ip          = stack->m_IP; fDirty = true ; RESETSTACK(); }
 #define WRITEBACK(stack,evalPos,ip,fDirty)  { stack->m_evalStackPos = &evalPos              [ +1 ]; stack->m_IP = ip         ; fDirty = false; RESETSTACK(); }
 
+#if defined(TINYCLR_PROFILE_OPCODES)
+#define COUNT_OPCODE(op)                    { g_CLR_RT_ExecutionEngine.m_opcodeCounts          [ op ]++; }
+#define COUNT_SUPERINSTRUCTION(kind)        { g_CLR_RT_ExecutionEngine.m_superInstructionCounts[ CLR_RT_ExecutionEngine::kind ]++; }
+#else
+#define COUNT_OPCODE(op)
+#define COUNT_SUPERINSTRUCTION(kind)
+#endif
+
+//
+// The ldarg/ldloc + ldfld fusion only takes the quickened ldfld, which carries the field offset.
+// A plain ldfld would have to resolve its token on every execution, which costs more than the fusion saves.
+//
+#if defined(TINYCLR_QUICKENING)
+#define ISLDFLD(ip)                         (*(ip) == CEE_LDFLD_QUICK)
+#else
+#define ISLDFLD(ip)                         false
+#endif
+
+#if defined(TINYCLR_ENABLE_SOURCELEVELDEBUGGING)
+#define CHECKQUANTUM(th)                    { if(th->m_timeQuantumExpired == TRUE) TINYCLR_SET_AND_LEAVE( CLR_S_QUANTUM_EXPIRED ); }
+#define CANFUSE(stack)                      ((stack->m_flags & CLR_RT_StackFrame::c_HasBreakpoint) == 0) // Don't skip over an instruction the debugger may be stepping to.
+#else
+#define CHECKQUANTUM(th)
+#define CANFUSE(stack)                      true
+#endif
+
+//
+// With threaded dispatch every handler exit fetches the next opcode and jumps straight to its handler,
+// instead of going back through the top of the loop and the switch.
+//
+#if defined(TINYCLR_THREADED_DISPATCH)
+#define DISPATCH_NEXT(th,stack,assm,ip,op)  { CHECKQUANTUM(th); assm->DumpOpcode( stack, ip ); op = CLR_OPCODE(*ip++); COUNT_OPCODE(op); goto *c_dispatch[ op ]; }
+#else
+#define DISPATCH_NEXT(th,stack,assm,ip,op)  continue
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 bool CLR_RT_HeapBlock::InitObject()
@@ -356,6 +392,20 @@ bool CLR_RT_Thread::FindEhBlock( CLR_RT_StackFrame* stack, CLR_PMETADATA from, C
         {
             if(ptrEh)
             {
+                //
+                // Looking for finallys (leave, endfinally, second pass), catch clauses can't match: don't resolve their types.
+                //
+                if(onlyFinallys)
+                {
+                    CLR_UINT16 mode; memcpy( &mode, &ptrEh->mode, sizeof(mode) );
+
+                    if(mode == CLR_RECORD_EH::EH_Catch || mode == CLR_RECORD_EH::EH_CatchAll)
+                    {
+                        ptrEh++;
+                        continue;
+                    }
+                }
+
                 eh.ConvertFromEH( stack->m_call, stack->m_IPstart, ptrEh++ );
 
                 ptrEhExt = &eh;
@@ -833,6 +883,18 @@ HRESULT CLR_RT_Thread::Execute_IL( CLR_RT_StackFrame* stack )
     CLR_PMETADATA      ip;
     bool               fCondition;
     bool               fDirty = false;
+#if defined(TINYCLR_SUPER_INSTRUCTIONS)
+    CLR_RT_HeapBlock*  fuseSource;
+#endif
+
+#if defined(TINYCLR_THREADED_DISPATCH)
+    static const void* const c_dispatch[] =
+    {
+#define OPDEF(name,string,pop,push,oprType,opcType,l,s1,s2,ctrl) &&Execute_##name,
+#include <opcode.def>
+#undef OPDEF
+    };
+#endif
 
     READCACHE(stack,evalPos,ip,fDirty);
 
@@ -876,6 +938,8 @@ HRESULT CLR_RT_Thread::Execute_IL( CLR_RT_StackFrame* stack )
 
 Execute_RestartDecoding:
 
+        COUNT_OPCODE(op);
+
 #if defined(TINYCLR_OPCODE_STACKCHANGES)
         if(op != CEE_PREFIX1)
         {
@@ -906,7 +970,11 @@ Execute_RestartDecoding:
 
             switch(op)
             {
+#if defined(TINYCLR_THREADED_DISPATCH)
+#define OPDEF(name,string,pop,push,oprType,opcType,l,s1,s2,ctrl) case name: Execute_##name:
+#else
 #define OPDEF(name,string,pop,push,oprType,opcType,l,s1,s2,ctrl) case name:
+#endif
             OPDEF(CEE_PREFIX1,                    "prefix1",          Pop0,               Push0,       InlineNone,         IInternal,   1,  0xFF,    0xFE,    META)
             {
                 op = CLR_OPCODE(*ip++ + 256);
@@ -921,6 +989,14 @@ Execute_RestartDecoding:
             OPDEF(CEE_LDARG_0,                    "ldarg.0",          Pop0,               Push1,       InlineNone,         IMacro,      1,  0xFF,    0x02,    NEXT)
             // Stack: ... ... -> <value> ...
             {
+#if defined(TINYCLR_SUPER_INSTRUCTIONS)
+                if(ISLDFLD(ip))
+                {
+                    fuseSource = &stack->m_arguments[ 0 ];
+                    goto Execute_LoadVariableAndField;
+                }
+#endif
+
                 evalPos++; CHECKSTACK(stack,evalPos);
 
                 evalPos[ 0 ].Assign( stack->m_arguments[ 0 ] );
@@ -969,6 +1045,14 @@ Execute_RestartDecoding:
             OPDEF(CEE_LDLOC_0,                    "ldloc.0",          Pop0,               Push1,       InlineNone,         IMacro,      1,  0xFF,    0x06,    NEXT)
             // Stack: ... ... -> <value> ...
             {
+#if defined(TINYCLR_SUPER_INSTRUCTIONS)
+                if(ISLDFLD(ip))
+                {
+                    fuseSource = &stack->m_locals[ 0 ];
+                    goto Execute_LoadVariableAndField;
+                }
+#endif
+
                 evalPos++; CHECKSTACK(stack,evalPos);
 
                 evalPos[ 0 ].Assign( stack->m_locals[ 0 ] );
@@ -979,6 +1063,14 @@ Execute_RestartDecoding:
             OPDEF(CEE_LDLOC_1,                    "ldloc.1",          Pop0,               Push1,       InlineNone,         IMacro,      1,  0xFF,    0x07,    NEXT)
             // Stack: ... ... -> <value> ...
             {
+#if defined(TINYCLR_SUPER_INSTRUCTIONS)
+                if(ISLDFLD(ip))
+                {
+                    fuseSource = &stack->m_locals[ 1 ];
+                    goto Execute_LoadVariableAndField;
+                }
+#endif
+
                 evalPos++; CHECKSTACK(stack,evalPos);
 
                 evalPos[ 0 ].Assign( stack->m_locals[ 1 ] );
@@ -989,6 +1081,14 @@ Execute_RestartDecoding:
             OPDEF(CEE_LDLOC_2,                    "ldloc.2",          Pop0,               Push1,       InlineNone,         IMacro,      1,  0xFF,    0x08,    NEXT)
             // Stack: ... ... -> <value> ...
             {
+#if defined(TINYCLR_SUPER_INSTRUCTIONS)
+                if(ISLDFLD(ip))
+                {
+                    fuseSource = &stack->m_locals[ 2 ];
+                    goto Execute_LoadVariableAndField;
+                }
+#endif
+
                 evalPos++; CHECKSTACK(stack,evalPos);
 
                 evalPos[ 0 ].Assign( stack->m_locals[ 2 ] );
@@ -999,6 +1099,14 @@ Execute_RestartDecoding:
             OPDEF(CEE_LDLOC_3,                    "ldloc.3",          Pop0,               Push1,       InlineNone,         IMacro,      1,  0xFF,    0x09,    NEXT)
             // Stack: ... ... -> <value> ...
             {
+#if defined(TINYCLR_SUPER_INSTRUCTIONS)
+                if(ISLDFLD(ip))
+                {
+                    fuseSource = &stack->m_locals[ 3 ];
+                    goto Execute_LoadVariableAndField;
+                }
+#endif
+
                 evalPos++; CHECKSTACK(stack,evalPos);
 
                 evalPos[ 0 ].Assign( stack->m_locals[ 3 ] );
@@ -1011,6 +1119,14 @@ Execute_RestartDecoding:
             {
                 FETCH_ARG_UINT8(arg,ip);
 
+#if defined(TINYCLR_SUPER_INSTRUCTIONS)
+                if(ISLDFLD(ip))
+                {
+                    fuseSource = &stack->m_locals[ arg ];
+                    goto Execute_LoadVariableAndField;
+                }
+#endif
+
                 evalPos++; CHECKSTACK(stack,evalPos);
 
                 evalPos[ 0 ].Assign( stack->m_locals[ arg ] );
@@ -1163,6 +1279,18 @@ Execute_RestartDecoding:
             OPDEF(CEE_LDC_I4_8,                   "ldc.i4.8",         Pop0,               PushI,       InlineNone,         IMacro,      1,  0xFF,    0x1E,    NEXT)
             // Stack: ... ... -> <value> ...
             {
+#if defined(TINYCLR_SUPER_INSTRUCTIONS)
+                if(*ip == CEE_ADD && evalPos[ 0 ].DataType() == DATATYPE_I4 && CANFUSE(stack))
+                {
+                    ip++;
+
+                    evalPos[ 0 ].NumericByRef().s4 += (CLR_INT32)op - (CLR_INT32)CEE_LDC_I4_0;
+
+                    COUNT_SUPERINSTRUCTION(c_SuperInstruction_AddConstant);
+                    break;
+                }
+#endif
+
                 evalPos++; CHECKSTACK(stack,evalPos);
 
                 evalPos[ 0 ].SetInteger( (CLR_INT32)op - (CLR_INT32)CEE_LDC_I4_0 );
@@ -1174,6 +1302,18 @@ Execute_RestartDecoding:
             {
                 FETCH_ARG_INT8(arg,ip);
 
+#if defined(TINYCLR_SUPER_INSTRUCTIONS)
+                if(*ip == CEE_ADD && evalPos[ 0 ].DataType() == DATATYPE_I4 && CANFUSE(stack))
+                {
+                    ip++;
+
+                    evalPos[ 0 ].NumericByRef().s4 += arg;
+
+                    COUNT_SUPERINSTRUCTION(c_SuperInstruction_AddConstant);
+                    break;
+                }
+#endif
+
                 evalPos++; CHECKSTACK(stack,evalPos);
 
                 evalPos[ 0 ].SetInteger( (CLR_INT32)arg );
@@ -1185,6 +1325,18 @@ Execute_RestartDecoding:
             {
                 FETCH_ARG_INT32(arg,ip);
 
+#if defined(TINYCLR_SUPER_INSTRUCTIONS)
+                if(*ip == CEE_ADD && evalPos[ 0 ].DataType() == DATATYPE_I4 && CANFUSE(stack))
+                {
+                    ip++;
+
+                    evalPos[ 0 ].NumericByRef().s4 += arg;
+
+                    COUNT_SUPERINSTRUCTION(c_SuperInstruction_AddConstant);
+                    break;
+                }
+#endif
+
                 evalPos++; CHECKSTACK(stack,evalPos);
 
                 evalPos[ 0 ].SetInteger( (CLR_INT32)arg );
@@ -2272,6 +2424,64 @@ Execute_RestartDecoding:
 
             //----------------------------------------------------------------------------------------------------------//
 
+#if defined(TINYCLR_QUICKENING)
+            OPDEF(CEE_UNUSED5,                    "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xA6,    NEXT)
+            // ldfld with the field offset instead of the token, only found in quickened methods (CEE_LDFLD_QUICK).
+            // Stack: ... <obj> -> <value> ...
+            {
+                CLR_RT_HeapBlock* obj = &evalPos[ 0 ];
+
+                if(obj->DataType() == DATATYPE_OBJECT)
+                {
+                    obj = obj->Dereference(); FAULT_ON_NULL(obj);
+
+                    if(obj->DataType() == DATATYPE_CLASS)
+                    {
+                        CLR_UINT32 offset; TINYCLR_READ_UNALIGNED_UINT16(offset,ip);
+
+                        evalPos[ 0 ].Assign( obj[ offset ] );
+
+                        goto Execute_LoadAndPromote;
+                    }
+                }
+
+                goto Execute_Deoptimize;
+            }
+
+            //----------------------------------------------------------------------------------------------------------//
+
+            OPDEF(CEE_UNUSED6,                    "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xA7,    NEXT)
+            // stfld with the field offset instead of the token, only found in quickened methods (CEE_STFLD_QUICK).
+            // Stack: ... ... <obj> <value> -> ...
+            {
+                evalPos -= 2; CHECKSTACK(stack,evalPos);
+
+                CLR_RT_HeapBlock* obj = &evalPos[ 1 ];
+
+                if(obj->DataType() == DATATYPE_OBJECT)
+                {
+                    obj = obj->Dereference(); FAULT_ON_NULL(obj);
+
+                    if(obj->DataType() == DATATYPE_CLASS)
+                    {
+                        CLR_UINT32 offset; TINYCLR_READ_UNALIGNED_UINT16(offset,ip);
+
+                        obj[ offset ].AssignAndPreserveType( evalPos[ 2 ] );
+                        break;
+                    }
+                }
+
+                //
+                // The original stfld pops the operands itself.
+                //
+                evalPos += 2;
+
+                goto Execute_Deoptimize;
+            }
+
+            //----------------------------------------------------------------------------------------------------------//
+#endif
+
             OPDEF(CEE_LDSFLD,                     "ldsfld",           Pop0,               Push1,       InlineField,        IObjModel,   1,  0xFF,    0x7E,    NEXT)
             // Stack: ... -> <value> ...
             {
@@ -2635,8 +2845,8 @@ Execute_RestartDecoding:
             {
                 evalPos--; CHECKSTACK(stack,evalPos);
 
-                evalPos[ 0 ].SetInteger( CLR_RT_HeapBlock::Compare_Signed_Values( evalPos[ 0 ], evalPos[ 1 ] ) == 0 ? 1 : 0 );
-                break;
+                fCondition = (CLR_RT_HeapBlock::Compare_Signed_Values( evalPos[ 0 ], evalPos[ 1 ] ) == 0);
+                goto Execute_Compare;
             }
 
             //----------------------------------------------------------------------------------------------------------//
@@ -2645,8 +2855,8 @@ Execute_RestartDecoding:
             {
                 evalPos--; CHECKSTACK(stack,evalPos);
 
-                evalPos[ 0 ].SetInteger( CLR_RT_HeapBlock::Compare_Signed_Values( evalPos[ 0 ], evalPos[ 1 ] ) > 0 ? 1 : 0 );
-                break;
+                fCondition = (CLR_RT_HeapBlock::Compare_Signed_Values( evalPos[ 0 ], evalPos[ 1 ] ) > 0);
+                goto Execute_Compare;
             }
 
             //----------------------------------------------------------------------------------------------------------//
@@ -2655,8 +2865,8 @@ Execute_RestartDecoding:
             {
                 evalPos--; CHECKSTACK(stack,evalPos);
 
-                evalPos[ 0 ].SetInteger( CLR_RT_HeapBlock::Compare_Unsigned_Values( evalPos[ 0 ], evalPos[ 1 ] ) > 0 ? 1 : 0 );
-                break;
+                fCondition = (CLR_RT_HeapBlock::Compare_Unsigned_Values( evalPos[ 0 ], evalPos[ 1 ] ) > 0);
+                goto Execute_Compare;
             }
 
             //----------------------------------------------------------------------------------------------------------//
@@ -2665,8 +2875,8 @@ Execute_RestartDecoding:
             {
                 evalPos--; CHECKSTACK(stack,evalPos);
 
-                evalPos[ 0 ].SetInteger( CLR_RT_HeapBlock::Compare_Signed_Values( evalPos[ 0 ], evalPos[ 1 ] ) < 0 ? 1 : 0 );
-                break;
+                fCondition = (CLR_RT_HeapBlock::Compare_Signed_Values( evalPos[ 0 ], evalPos[ 1 ] ) < 0);
+                goto Execute_Compare;
             }
 
             //----------------------------------------------------------------------------------------------------------//
@@ -2675,8 +2885,8 @@ Execute_RestartDecoding:
             {
                 evalPos--; CHECKSTACK(stack,evalPos);
 
-                evalPos[ 0 ].SetInteger( CLR_RT_HeapBlock::Compare_Unsigned_Values( evalPos[ 0 ], evalPos[ 1 ] ) < 0 ? 1 : 0 );
-                break;
+                fCondition = (CLR_RT_HeapBlock::Compare_Unsigned_Values( evalPos[ 0 ], evalPos[ 1 ] ) < 0);
+                goto Execute_Compare;
             }
 
             //----------------------------------------------------------------------------------------------------------//
@@ -2839,6 +3049,86 @@ Execute_RestartDecoding:
 
             //////////////////////////////////////////////////////////////////////////////////////////
 
+            //
+            // Not real instructions, listed so that every opcode has a dispatch target.
+            //
+            OPDEF(CEE_UNUSED49,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0x24,    NEXT)
+            OPDEF(CEE_UNUSED58,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0x77,    NEXT)
+            OPDEF(CEE_UNUSED1,                    "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0x78,    NEXT)
+#if !defined(TINYCLR_QUICKENING)
+            OPDEF(CEE_UNUSED5,                    "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xA6,    NEXT)
+            OPDEF(CEE_UNUSED6,                    "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xA7,    NEXT)
+#endif
+            OPDEF(CEE_UNUSED7,                    "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xA8,    NEXT)
+            OPDEF(CEE_UNUSED8,                    "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xA9,    NEXT)
+            OPDEF(CEE_UNUSED9,                    "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xAA,    NEXT)
+            OPDEF(CEE_UNUSED10,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xAB,    NEXT)
+            OPDEF(CEE_UNUSED11,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xAC,    NEXT)
+            OPDEF(CEE_UNUSED12,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xAD,    NEXT)
+            OPDEF(CEE_UNUSED13,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xAE,    NEXT)
+            OPDEF(CEE_UNUSED14,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xAF,    NEXT)
+            OPDEF(CEE_UNUSED15,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xB0,    NEXT)
+            OPDEF(CEE_UNUSED16,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xB1,    NEXT)
+            OPDEF(CEE_UNUSED17,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xB2,    NEXT)
+            OPDEF(CEE_UNUSED50,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xBB,    NEXT)
+            OPDEF(CEE_UNUSED18,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xBC,    NEXT)
+            OPDEF(CEE_UNUSED19,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xBD,    NEXT)
+            OPDEF(CEE_UNUSED20,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xBE,    NEXT)
+            OPDEF(CEE_UNUSED21,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xBF,    NEXT)
+            OPDEF(CEE_UNUSED22,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xC0,    NEXT)
+            OPDEF(CEE_UNUSED23,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xC1,    NEXT)
+            OPDEF(CEE_UNUSED24,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xC4,    NEXT)
+            OPDEF(CEE_UNUSED25,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xC5,    NEXT)
+            OPDEF(CEE_UNUSED59,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xC7,    NEXT)
+            OPDEF(CEE_UNUSED60,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xC8,    NEXT)
+            OPDEF(CEE_UNUSED61,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xC9,    NEXT)
+            OPDEF(CEE_UNUSED62,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xCA,    NEXT)
+            OPDEF(CEE_UNUSED63,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xCB,    NEXT)
+            OPDEF(CEE_UNUSED64,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xCC,    NEXT)
+            OPDEF(CEE_UNUSED65,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xCD,    NEXT)
+            OPDEF(CEE_UNUSED66,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xCE,    NEXT)
+            OPDEF(CEE_UNUSED67,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xCF,    NEXT)
+            OPDEF(CEE_UNUSED26,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xE1,    NEXT)
+            OPDEF(CEE_UNUSED27,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xE2,    NEXT)
+            OPDEF(CEE_UNUSED28,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xE3,    NEXT)
+            OPDEF(CEE_UNUSED29,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xE4,    NEXT)
+            OPDEF(CEE_UNUSED30,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xE5,    NEXT)
+            OPDEF(CEE_UNUSED31,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xE6,    NEXT)
+            OPDEF(CEE_UNUSED32,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xE7,    NEXT)
+            OPDEF(CEE_UNUSED33,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xE8,    NEXT)
+            OPDEF(CEE_UNUSED34,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xE9,    NEXT)
+            OPDEF(CEE_UNUSED35,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xEA,    NEXT)
+            OPDEF(CEE_UNUSED36,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xEB,    NEXT)
+            OPDEF(CEE_UNUSED37,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xEC,    NEXT)
+            OPDEF(CEE_UNUSED38,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xED,    NEXT)
+            OPDEF(CEE_UNUSED39,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xEE,    NEXT)
+            OPDEF(CEE_UNUSED40,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xEF,    NEXT)
+            OPDEF(CEE_UNUSED41,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xF0,    NEXT)
+            OPDEF(CEE_UNUSED42,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xF1,    NEXT)
+            OPDEF(CEE_UNUSED43,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xF2,    NEXT)
+            OPDEF(CEE_UNUSED44,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xF3,    NEXT)
+            OPDEF(CEE_UNUSED45,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xF4,    NEXT)
+            OPDEF(CEE_UNUSED46,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xF5,    NEXT)
+            OPDEF(CEE_UNUSED47,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xF6,    NEXT)
+            OPDEF(CEE_UNUSED48,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  1,  0xFF,    0xF7,    NEXT)
+            OPDEF(CEE_PREFIX7,                    "prefix7",          Pop0,               Push0,       InlineNone,         IInternal,   1,  0xFF,    0xF8,    META)
+            OPDEF(CEE_PREFIX6,                    "prefix6",          Pop0,               Push0,       InlineNone,         IInternal,   1,  0xFF,    0xF9,    META)
+            OPDEF(CEE_PREFIX5,                    "prefix5",          Pop0,               Push0,       InlineNone,         IInternal,   1,  0xFF,    0xFA,    META)
+            OPDEF(CEE_PREFIX4,                    "prefix4",          Pop0,               Push0,       InlineNone,         IInternal,   1,  0xFF,    0xFB,    META)
+            OPDEF(CEE_PREFIX3,                    "prefix3",          Pop0,               Push0,       InlineNone,         IInternal,   1,  0xFF,    0xFC,    META)
+            OPDEF(CEE_PREFIX2,                    "prefix2",          Pop0,               Push0,       InlineNone,         IInternal,   1,  0xFF,    0xFD,    META)
+            OPDEF(CEE_PREFIXREF,                  "prefixref",        Pop0,               Push0,       InlineNone,         IInternal,   1,  0xFF,    0xFF,    META)
+            OPDEF(CEE_UNUSED56,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  2,  0xFE,    0x08,    NEXT)
+            OPDEF(CEE_UNUSED57,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  2,  0xFE,    0x10,    NEXT)
+            OPDEF(CEE_UNUSED69,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  2,  0xFE,    0x19,    NEXT)
+            OPDEF(CEE_UNUSED51,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  2,  0xFE,    0x1B,    NEXT)
+            OPDEF(CEE_UNUSED53,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  2,  0xFE,    0x1F,    NEXT)
+            OPDEF(CEE_UNUSED54,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  2,  0xFE,    0x20,    NEXT)
+            OPDEF(CEE_UNUSED55,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  2,  0xFE,    0x21,    NEXT)
+            OPDEF(CEE_UNUSED70,                   "unused",           Pop0,               Push0,       InlineNone,         IPrimitive,  2,  0xFE,    0x22,    NEXT)
+            OPDEF(CEE_ILLEGAL,                    "illegal",          Pop0,               Push0,       InlineNone,         IInternal,   0,  MOOT,    MOOT,    META)
+            OPDEF(CEE_MACRO_END,                  "endmac",           Pop0,               Push0,       InlineNone,         IInternal,   0,  MOOT,    MOOT,    META)
+
             default:
                 TINYCLR_CHECK_HRESULT(CLR_Checks::VerifyUnknownInstruction( op ));
                 break;
@@ -2852,7 +3142,98 @@ Execute_RestartDecoding:
             }
 #endif //#if defined(TINYCLR_ENABLE_SOURCELEVELDEBUGGING)
 
-            continue;
+            DISPATCH_NEXT(th,stack,assm,ip,op);
+
+            //--//
+
+#if defined(TINYCLR_QUICKENING)
+    Execute_Deoptimize:
+            //
+            // The receiver is not a plain object (value type, proxy, byref): put the original instruction back and run that instead.
+            //
+            ip--;
+
+            g_CLR_RT_ExecutionEngine.Quickening_Deoptimize( stack, ip );
+
+            DISPATCH_NEXT(th,stack,assm,ip,op);
+
+            //--//
+#endif
+
+#if defined(TINYCLR_SUPER_INSTRUCTIONS)
+    Execute_LoadVariableAndField:
+            //
+            // ldarg/ldloc + ldfld: read the field straight out of the object referenced by the variable.
+            //
+            {
+                CLR_RT_HeapBlock* obj = fuseSource;
+
+                if(obj->DataType() == DATATYPE_OBJECT && CANFUSE(stack))
+                {
+                    obj = obj->Dereference();
+
+#if defined(TINYCLR_QUICKENING)
+                    if(obj && obj->DataType() == DATATYPE_CLASS)
+                    {
+                        CLR_PMETADATA ipNext = ip + 1;
+                        CLR_UINT32    offset; TINYCLR_READ_UNALIGNED_UINT16(offset,ipNext);
+
+                        ip = ipNext;
+
+                        evalPos++; CHECKSTACK(stack,evalPos);
+
+                        evalPos[ 0 ].Assign( obj[ offset ] );
+
+                        COUNT_SUPERINSTRUCTION(c_SuperInstruction_LoadField);
+                        goto Execute_LoadAndPromote;
+                    }
+#endif
+                }
+
+                //
+                // Anything else (null, value types, proxies) goes through the regular ldfld.
+                //
+                evalPos++; CHECKSTACK(stack,evalPos);
+
+                evalPos[ 0 ].Assign( *fuseSource );
+
+                goto Execute_LoadAndPromote;
+            }
+
+            //--//
+#endif
+
+    Execute_Compare:
+            {
+#if defined(TINYCLR_SUPER_INSTRUCTIONS)
+                //
+                // ceq/cgt/clt + brtrue/brfalse: branch on the comparison without pushing its result.
+                //
+                CLR_OPCODE opNext = CLR_OPCODE(*ip);
+
+                if((opNext == CEE_BRTRUE_S || opNext == CEE_BRTRUE || opNext == CEE_BRFALSE_S || opNext == CEE_BRFALSE) && CANFUSE(stack))
+                {
+                    if(opNext == CEE_BRFALSE_S || opNext == CEE_BRFALSE) fCondition = !fCondition;
+
+                    evalPos--; CHECKSTACK(stack,evalPos);
+
+                    op = opNext; ip++;
+
+                    COUNT_SUPERINSTRUCTION(c_SuperInstruction_CompareBranch);
+                    goto Execute_BR;
+                }
+#endif
+
+                evalPos[ 0 ].SetInteger( fCondition ? 1 : 0 );
+            }
+
+#if defined(TINYCLR_ENABLE_SOURCELEVELDEBUGGING)
+            if(stack->m_flags & CLR_RT_StackFrame::c_HasBreakpoint)
+            {
+                g_CLR_RT_ExecutionEngine.Breakpoint_StackFrame_Step( stack, ip );
+            }
+#endif //#if defined(TINYCLR_ENABLE_SOURCELEVELDEBUGGING)
+            DISPATCH_NEXT(th,stack,assm,ip,op);
 
             //--//
 
@@ -2901,7 +3282,7 @@ Execute_RestartDecoding:
                 g_CLR_RT_ExecutionEngine.Breakpoint_StackFrame_Step( stack, ip );
             }
 #endif //#if defined(TINYCLR_ENABLE_SOURCELEVELDEBUGGING)
-            continue;
+            DISPATCH_NEXT(th,stack,assm,ip,op);
 
             //--//
 
@@ -2932,7 +3313,7 @@ Execute_RestartDecoding:
                     TINYCLR_SET_AND_LEAVE( CLR_S_QUANTUM_EXPIRED );
                 }
 
-                continue;
+                DISPATCH_NEXT(th,stack,assm,ip,op);
             }
 
             //--//
@@ -219,6 +219,7 @@ HRESULT CLR_RT_Thread::CreateInstance( int pid, int priority, CLR_RT_Thread*& th
         th->m_waitForObject                  = NULL;
                                                                                 //
         th->m_stackFrames                    .DblLinkedList_Initialize();       // CLR_RT_DblLinkedList       m_stackFrames;
+        th->m_stackFramesFree                .DblLinkedList_Initialize();       // CLR_RT_DblLinkedList       m_stackFramesFree;
                                                                                 //
         th->m_subThreads                     .DblLinkedList_Initialize();       // CLR_RT_DblLinkedList       m_subThreads;
                                                                                 //
@@ -296,8 +297,13 @@ bool CLR_RT_Thread::ReleaseWhenDeadEx()
 
     if(this == g_CLR_RT_ExecutionEngine.m_finalizerThread) g_CLR_RT_ExecutionEngine.m_finalizerThread = NULL;
     if(this == g_CLR_RT_ExecutionEngine.m_interruptThread) g_CLR_RT_ExecutionEngine.m_interruptThread = NULL;
-    if(this == g_CLR_RT_ExecutionEngine.m_timerThread    ) g_CLR_RT_ExecutionEngine.m_timerThread     = NULL;
+    for(int i = 0; i < CLR_RT_ExecutionEngine::c_NumOfTimerThreads; i++)
+    {
+        if(this == g_CLR_RT_ExecutionEngine.m_timerThreads[ i ]) g_CLR_RT_ExecutionEngine.m_timerThreads[ i ] = NULL;
+    }
     if(this == g_CLR_RT_ExecutionEngine.m_cctorThread    ) g_CLR_RT_ExecutionEngine.m_cctorThread     = NULL;
+
+    m_stackFramesFree.DblLinkedList_PushToCache();
     
     return ReleaseWhenDead();
 }
@@ -427,11 +433,13 @@ void CLR_RT_Thread::Passivate()
     m_waitForEvents         = 0;
     m_waitForEvents_Timeout = TIMEOUT_INFINITE;
 
+    m_stackFramesFree.DblLinkedList_PushToCache();
+
     //--//
 
     if(m_waitForObject != NULL)
     {
-        g_CLR_RT_EventCache.Append_Node( m_waitForObject );
+        m_waitForObject->Release();
         m_waitForObject = NULL;
     }
 
@@ -1522,6 +1522,26 @@ void CLR_RT_Assembly::Assembly_Initialize( CLR_RT_Assembly::Offsets& offsets )
         ITERATE_THROUGH_RECORDS(this,i,MethodDef,METHODDEF)
         {
             dst->m_data = CLR_EmptyIndex;
+#if defined(TINYCLR_QUICKENING)
+            dst->m_quickCalls = 0;
+            dst->m_quickSlot  = 0;
+#endif
+        }
+    }
+
+    {
+        //
+        // A method ends where the next method with byte code starts, the last one at the end of the byte code table.
+        //
+        CLR_OFFSET end = (CLR_OFFSET)m_pTablesSize[ TBL_ByteCode ];
+
+        for(i = m_pTablesSize[ TBL_MethodDef ]; i-- > 0; )
+        {
+            CLR_OFFSET rva = GetMethodDef( i )->RVA;
+
+            m_pCrossReference_MethodDef[ i ].m_end = end;
+
+            if(rva != CLR_EmptyIndex) end = rva;
         }
     }
 
@@ -1532,6 +1552,33 @@ void CLR_RT_Assembly::Assembly_Initialize( CLR_RT_Assembly::Offsets& offsets )
         memset( m_pDebuggingInfo_MethodDef, 0, offsets.iDebuggingInfoMethods );
     }
 #endif //#if defined(TINYCLR_ENABLE_SOURCELEVELDEBUGGING)
+
+#if defined(TINYCLR_FRAME_TEMPLATES)
+    {
+        CLR_UINT32 offset = 0;
+
+        m_pFrameTemplates = (CLR_UINT8*)buffer; buffer += offsets.iFrameTemplates;
+
+        memset( m_pFrameTemplates, 0, offsets.iFrameTemplates );
+
+        //
+        // Templates are filled on the first call, see CLR_RT_StackFrame::Push.
+        //
+        ITERATE_THROUGH_RECORDS(this,i,MethodDef,METHODDEF)
+        {
+            if(offset < CLR_EmptyIndex)
+            {
+                dst->m_frameTemplate = (CLR_UINT16)offset;
+            }
+            else
+            {
+                dst->m_frameTemplate = CLR_EmptyIndex;
+            }
+
+            offset += 1 + src->numLocals;
+        }
+    }
+#endif
 }
 
 HRESULT CLR_RT_Assembly::CreateInstance( const CLR_RECORD_ASSEMBLY* header, CLR_RT_Assembly*& assm )
@@ -1588,6 +1635,20 @@ HRESULT CLR_RT_Assembly::CreateInstance( const CLR_RECORD_ASSEMBLY* header, CLR_
         }
     }
 
+#if defined(TINYCLR_FRAME_TEMPLATES)
+    //
+    // Size the frame templates: one header byte and one byte per local for each method.
+    //
+    {
+        const CLR_RECORD_METHODDEF* src = (const CLR_RECORD_METHODDEF*)skeleton->GetTable( TBL_MethodDef );
+
+        for(int i=0; i<skeleton->m_pTablesSize[ TBL_MethodDef ]; i++, src++)
+        {
+            skeleton->m_iFrameTemplates += 1 + src->numLocals;
+        }
+    }
+#endif
+
     //--//
 
     {
@@ -1615,6 +1676,10 @@ HRESULT CLR_RT_Assembly::CreateInstance( const CLR_RECORD_ASSEMBLY* header, CLR_
         offsets.iDebuggingInfoMethods = ROUNDTOMULTIPLE(skeleton->m_pTablesSize[ TBL_MethodDef ] * sizeof(CLR_RT_MethodDef_DebuggingInfo   ), CLR_UINT32);
 #endif //#if defined(TINYCLR_ENABLE_SOURCELEVELDEBUGGING)
 
+#if defined(TINYCLR_FRAME_TEMPLATES)
+        offsets.iFrameTemplates       = ROUNDTOMULTIPLE(skeleton->m_iFrameTemplates              * sizeof(CLR_UINT8                        ), CLR_UINT32);
+#endif
+
         size_t iTotalRamSize = offsets.iBase           +
                                offsets.iAssemblyRef    +
                                offsets.iTypeRef        +
@@ -1632,6 +1697,10 @@ HRESULT CLR_RT_Assembly::CreateInstance( const CLR_RECORD_ASSEMBLY* header, CLR_
         iTotalRamSize += offsets.iDebuggingInfoMethods;
 #endif //#if defined(TINYCLR_ENABLE_SOURCELEVELDEBUGGING)
 
+#if defined(TINYCLR_FRAME_TEMPLATES)
+        iTotalRamSize += offsets.iFrameTemplates;
+#endif
+
         //--//
 
         assm = EVENTCACHE_EXTRACT_NODE_AS_BYTES(g_CLR_RT_EventCache,CLR_RT_Assembly,DATATYPE_ASSEMBLY,0,(CLR_UINT32)iTotalRamSize); CHECK_ALLOCATION(assm);
@@ -1675,6 +1744,9 @@ HRESULT CLR_RT_Assembly::CreateInstance( const CLR_RECORD_ASSEMBLY* header, CLR_
             CLR_Debug::Printf( "   MethodDef      = %8d bytes (%8d elements)\r\n", offsets.iMethodDef     , skeleton->m_pTablesSize[ TBL_MethodDef   ] );
 #if !defined(TINYCLR_APPDOMAINS) 
             CLR_Debug::Printf( "   StaticFields   = %8d bytes (%8d elements)\r\n", offsets.iStaticFields  , skeleton->m_iStaticFields                );
+#endif
+#if defined(TINYCLR_FRAME_TEMPLATES)
+            CLR_Debug::Printf( "   FrameTemplates = %8d bytes (%8d elements)\r\n", offsets.iFrameTemplates, skeleton->m_iFrameTemplates              );
 #endif
             CLR_Debug::Printf( "\r\n" );
 
@@ -2016,6 +2088,8 @@ void CLR_RT_Assembly::Resolve_Link()
 
 #if defined(TINYCLR_APPDOMAINS)
 
+CT_ASSERT_UNIQUE_NAME(CLR_RT_AppDomain::c_MaxAssemblies == CLR_RT_TypeSystem::c_MaxAssemblies, AppDomain_MaxAssemblies)
+
 HRESULT CLR_RT_AppDomain::CreateInstance( LPCSTR szName, CLR_RT_AppDomain*& appDomain )
 {
     NATIVE_PROFILE_CLR_CORE();
@@ -2086,6 +2160,8 @@ void CLR_RT_AppDomain::AppDomain_Initialize()
     m_strName                     = NULL;
     m_outOfMemoryException        = NULL;
     m_appDomainAssemblyLastAccess = NULL;
+
+    TINYCLR_CLEAR(m_staticFields);
 }
 
 void CLR_RT_AppDomain::AppDomain_Uninitialize()
@@ -2561,6 +2637,8 @@ HRESULT CLR_RT_AppDomainAssembly::AppDomainAssembly_Initialize( CLR_RT_AppDomain
 
     appDomain->m_appDomainAssemblies.LinkAtBack( this );
 
+    appDomain->m_staticFields[ assm->m_idx - 1 ] = m_pStaticFields;
+
     TINYCLR_CHECK_HRESULT(assm->Resolve_AllocateStaticFields( m_pStaticFields ));
 
     if(!CLR_EE_DBG_IS_MASK(State_Initialize,State_Mask))
@@ -2574,6 +2652,8 @@ HRESULT CLR_RT_AppDomainAssembly::AppDomainAssembly_Initialize( CLR_RT_AppDomain
 
     if(FAILED(hr))
     {
+        appDomain->m_staticFields[ assm->m_idx - 1 ] = NULL;
+
         Unlink();
     }
 
@@ -2585,6 +2665,11 @@ HRESULT CLR_RT_AppDomainAssembly::AppDomainAssembly_Initialize( CLR_RT_AppDomain
 void CLR_RT_AppDomainAssembly::DestroyInstance()
 {
     NATIVE_PROFILE_CLR_CORE();
+    if(m_appDomain && m_appDomain->m_staticFields[ m_assembly->m_idx - 1 ] == m_pStaticFields)
+    {
+        m_appDomain->m_staticFields[ m_assembly->m_idx - 1 ] = NULL;
+    }
+
     Unlink();
 
     g_CLR_RT_EventCache.Append_Node( this );
@@ -3080,24 +3165,7 @@ bool CLR_RT_Assembly::FindMethodBoundaries( CLR_IDX i, CLR_OFFSET& start, CLR_OF
     if(p->RVA == CLR_EmptyIndex) return false;
 
     start = p->RVA;
-
-    while(true)
-    {
-        p++;
-        i++;
-
-        if(i == m_pTablesSize[ TBL_MethodDef ])
-        {
-            end = m_pTablesSize[ TBL_ByteCode ];
-            break;
-        }
-
-        if(p->RVA != CLR_EmptyIndex)
-        {
-            end = p->RVA;
-            break;
-        }
-    }
+    end   = m_pCrossReference_MethodDef[ i ].m_end;
 
     return true;
 }
@@ -3777,6 +3845,10 @@ HRESULT CLR_RT_TypeSystem::ResolveAll()
                 offsets.iDebuggingInfoMethods += ROUNDTOMULTIPLE(pASSM->m_pTablesSize[ TBL_MethodDef ] * sizeof(CLR_RT_MethodDef_DebuggingInfo   ), CLR_UINT32);
 #endif //#if defined(TINYCLR_ENABLE_SOURCELEVELDEBUGGING)
 
+#if defined(TINYCLR_FRAME_TEMPLATES)
+                offsets.iFrameTemplates       += ROUNDTOMULTIPLE(pASSM->m_iFrameTemplates              * sizeof(CLR_UINT8                        ), CLR_UINT32);
+#endif
+
                 iMetaData += pASSM->m_header->SizeOfTable( TBL_AssemblyRef ) +
                              pASSM->m_header->SizeOfTable( TBL_TypeRef     ) +
                              pASSM->m_header->SizeOfTable( TBL_FieldRef    ) +
@@ -3812,6 +3884,10 @@ HRESULT CLR_RT_TypeSystem::ResolveAll()
             iTotalRamSize += offsets.iStaticFields;
 #endif
 
+#if defined(TINYCLR_FRAME_TEMPLATES)
+            iTotalRamSize += offsets.iFrameTemplates;
+#endif
+
             CLR_Debug::Printf( "\r\nTotal: (%d RAM - %d ROM - %d METADATA)\r\n\r\n", iTotalRamSize, iTotalRomSize, iMetaData );
 
             CLR_Debug::Printf( "   AssemblyRef    = %8d bytes (%8d elements)\r\n", offsets.iAssemblyRef   , pTablesSize[TBL_AssemblyRef] );
@@ -3833,6 +3909,11 @@ HRESULT CLR_RT_TypeSystem::ResolveAll()
             CLR_Debug::Printf( "\r\n" );
 #endif //#if defined(TINYCLR_ENABLE_SOURCELEVELDEBUGGING)
 
+#if defined(TINYCLR_FRAME_TEMPLATES)
+            CLR_Debug::Printf( "   FrameTemplates = %8d bytes\r\n", offsets.iFrameTemplates );
+            CLR_Debug::Printf( "\r\n" );
+#endif
+
             CLR_Debug::Printf( "   Attributes      = %8d bytes (%8d elements)\r\n", pTablesSize[ TBL_Attributes     ] * sizeof(CLR_RECORD_ATTRIBUTE     ), pTablesSize[ TBL_Attributes     ] );
             CLR_Debug::Printf( "   TypeSpec        = %8d bytes (%8d elements)\r\n", pTablesSize[ TBL_TypeSpec       ] * sizeof(CLR_RECORD_TYPESPEC      ), pTablesSize[ TBL_TypeSpec       ] );
             CLR_Debug::Printf( "   Resources Files = %8d bytes (%8d elements)\r\n", pTablesSize[ TBL_ResourcesFiles ] * sizeof(CLR_RECORD_RESOURCE_FILE ), pTablesSize[ TBL_ResourcesFiles ] );
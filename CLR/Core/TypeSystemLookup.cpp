@@ -1778,3 +1778,49 @@ const CLR_RT_LogicalOpcodeLookup c_CLR_RT_LogicalOpcodeLookup[] =
 
     OPDEF(Unsupported           , VAL_NONE       ),    // LO_Unsupported               = 0x40,
 };
+
+//--//
+
+//
+// Operand sizes of the compressed byte code, indexed by CLR_OpcodeParam.
+// Kept here rather than with the diagnostics because the runtime walks byte code too (quickening, jitter).
+//
+const CLR_UINT8 c_CLR_opParamSizeCompressed[] =
+{
+    2, // CLR_OpcodeParam_Field
+    2, // CLR_OpcodeParam_Method
+    2, // CLR_OpcodeParam_Type
+    2, // CLR_OpcodeParam_String
+    4, // CLR_OpcodeParam_Tok
+    4, // CLR_OpcodeParam_Sig
+    2, // CLR_OpcodeParam_BrTarget
+    1, // CLR_OpcodeParam_ShortBrTarget
+    4, // CLR_OpcodeParam_I
+    8, // CLR_OpcodeParam_I8
+    0, // CLR_OpcodeParam_None
+    8, // CLR_OpcodeParam_R
+    1, // CLR_OpcodeParam_Switch
+    2, // CLR_OpcodeParam_Var
+    1, // CLR_OpcodeParam_ShortI
+    4, // CLR_OpcodeParam_ShortR
+    1, // CLR_OpcodeParam_ShortVar
+};
+
+const CLR_UINT8* CLR_SkipBodyOfOpcodeCompressed( const CLR_UINT8* ip, CLR_OPCODE opcode )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    CLR_OpcodeParam opParam = c_CLR_RT_OpcodeLookup[ opcode ].m_opParam;
+
+    if(opParam == CLR_OpcodeParam_Switch)
+    {
+        CLR_UINT32 numcases; TINYCLR_READ_UNALIGNED_UINT8(numcases, ip);
+
+        ip += numcases * sizeof(CLR_UINT16);
+    }
+    else
+    {
+        ip += c_CLR_opParamSizeCompressed[ opParam ];
+    }
+
+    return ip;
+}
@@ -88,12 +88,6 @@ const CLR_UINT8* CLR_SkipBodyOfOpcode( const CLR_UINT8* ip, CLR_OPCODE opcode )
     return 0;
 }
 
-const CLR_UINT8* CLR_SkipBodyOfOpcodeCompressed( const CLR_UINT8* ip, CLR_OPCODE opcode )
-{
-    NATIVE_PROFILE_CLR_DIAGNOSTICS();
-    return 0;
-}
-
 #if defined(TINYCLR_TRACE_INSTRUCTIONS)
 
 void CLR_RT_Assembly::DumpToken( CLR_UINT32 tk )
@@ -281,27 +281,6 @@ const CLR_UINT8 c_CLR_opParamSize[] =
     1, // CLR_OpcodeParam_ShortVar
 };
 
-const CLR_UINT8 c_CLR_opParamSizeCompressed[] =
-{
-    2, // CLR_OpcodeParam_Field
-    2, // CLR_OpcodeParam_Method
-    2, // CLR_OpcodeParam_Type
-    2, // CLR_OpcodeParam_String
-    4, // CLR_OpcodeParam_Tok
-    4, // CLR_OpcodeParam_Sig
-    2, // CLR_OpcodeParam_BrTarget
-    1, // CLR_OpcodeParam_ShortBrTarget
-    4, // CLR_OpcodeParam_I
-    8, // CLR_OpcodeParam_I8
-    0, // CLR_OpcodeParam_None
-    8, // CLR_OpcodeParam_R
-    1, // CLR_OpcodeParam_Switch
-    2, // CLR_OpcodeParam_Var
-    1, // CLR_OpcodeParam_ShortI
-    4, // CLR_OpcodeParam_ShortR
-    1, // CLR_OpcodeParam_ShortVar
-};
-
 CLR_UINT32 CLR_ReadTokenCompressed( const CLR_UINT8*& ip, CLR_OPCODE opcode )
 {
     NATIVE_PROFILE_CLR_DIAGNOSTICS();
@@ -352,25 +331,6 @@ const CLR_UINT8* CLR_SkipBodyOfOpcode( const CLR_UINT8* ip, CLR_OPCODE opcode )
     return ip;
 }
 
-const CLR_UINT8* CLR_SkipBodyOfOpcodeCompressed( const CLR_UINT8* ip, CLR_OPCODE opcode )
-{
-    NATIVE_PROFILE_CLR_DIAGNOSTICS();
-    CLR_OpcodeParam opParam = c_CLR_RT_OpcodeLookup[ opcode ].m_opParam;
-
-    if(opParam == CLR_OpcodeParam_Switch)
-    {
-        CLR_UINT32 numcases; TINYCLR_READ_UNALIGNED_UINT8(numcases, ip);
-
-        ip += numcases * sizeof(CLR_UINT16);
-    }
-    else
-    {
-        ip += c_CLR_opParamSizeCompressed[ opParam ];
-    }
-
-    return ip;
-}
-
 #endif // defined(PLATFORM_WINDOWS)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -57,6 +57,21 @@
 #if !defined(TINYCLR_NO_APPDOAMINS)
 #define TINYCLR_APPDOMAINS           // enables application doman support
 #endif
+#if !defined(TINYCLR_NO_FRAME_TEMPLATES)
+#define TINYCLR_FRAME_TEMPLATES      // caches the decoded local variables of each method for CLR_RT_StackFrame::Push
+#endif
+#if !defined(TINYCLR_NO_BOXING_CACHE)
+#define TINYCLR_BOXING_CACHE         // reuses one boxed instance per small bool/char/byte/short/int value
+#endif
+#if !defined(TINYCLR_NO_QUICKENING)
+#define TINYCLR_QUICKENING           // runs hot methods from a RAM copy of their byte code, with field accesses resolved to offsets
+#endif
+#if !defined(TINYCLR_NO_SUPER_INSTRUCTIONS)
+#define TINYCLR_SUPER_INSTRUCTIONS   // fuses common opcode pairs (ldarg/ldloc+ldfld, ldc+add, compare+branch) in Execute_IL
+#endif
+#if defined(__GNUC__) && !defined(TINYCLR_NO_THREADED_DISPATCH)
+#define TINYCLR_THREADED_DISPATCH    // dispatches Execute_IL through a computed goto table instead of a single switch
+#endif
 #define TINYCLR_TRACE_EXCEPTIONS     // enables exception dump support
 #define TINYCLR_TRACE_ERRORS         // enables rich exception dump support
 #if defined(DEBUG) || defined(_DEBUG)
@@ -64,6 +79,7 @@
 #endif
 //#define TINYCLR_TRACE_HRESULT        // enable tracing of HRESULTS from interop libraries 
 //#define TINYCLR_JITTER               // enables jitting
+//#define TINYCLR_PROFILE_OPCODES      // counts executed opcodes and super-instructions, dumped with the memory stats
 
 //-o-//-o-//-o-//-o-//-o-//-o-//
 // PLATFORMS
@@ -87,6 +103,33 @@
 #define HEAP_SIZE_THRESHOLD_UPPER   HEAP_SIZE_THRESHOLD + 30 * 1024
 #endif
 
+// Most elements an ArrayList, Queue or Stack adds in one growth step; below it their capacity doubles.
+#ifdef PLATFORM_DEPENDENT_COLLECTION_GROWTH_MAX
+#define COLLECTION_GROWTH_MAX   PLATFORM_DEPENDENT_COLLECTION_GROWTH_MAX
+#else
+#define COLLECTION_GROWTH_MAX   1024
+#endif
+
+// Range of the short and int values kept in the boxing cache, see CLR_RT_ExecutionEngine::BoxCache_Slot.
+#ifdef PLATFORM_DEPENDENT_BOXING_CACHE_MIN
+#define BOXING_CACHE_MIN    PLATFORM_DEPENDENT_BOXING_CACHE_MIN
+#else
+#define BOXING_CACHE_MIN    -128
+#endif
+
+#ifdef PLATFORM_DEPENDENT_BOXING_CACHE_MAX
+#define BOXING_CACHE_MAX    PLATFORM_DEPENDENT_BOXING_CACHE_MAX
+#else
+#define BOXING_CACHE_MAX    255
+#endif
+
+// RAM that the quickened copies of hot methods may use, see CLR_RT_ExecutionEngine::Quickening_Enter.
+#ifdef PLATFORM_DEPENDENT_QUICKENING_BUDGET
+#define QUICKENING_BUDGET   PLATFORM_DEPENDENT_QUICKENING_BUDGET
+#else
+#define QUICKENING_BUDGET   (8 * 1024)
+#endif
+
 //--//
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -150,6 +193,11 @@
 #define TINYCLR_OPCODE_STACKCHANGES
 #endif
 
+#if defined(TINYCLR_OPCODE_STACKCHANGES)
+#undef TINYCLR_THREADED_DISPATCH             // the stack changes are verified once per opcode at the top of the interpreter loop
+#undef TINYCLR_QUICKENING                    // the quick opcodes reuse unused slots, which have no stack changes in opcode.def
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #if !defined(TINYCLR_VALIDATE_HEAP)
@@ -636,6 +636,14 @@ struct CLR_RT_MethodDef_CrossReference
     static const CLR_UINT16 MD_CR_OwnerMask = 0x7FFF;
 
     CLR_UINT16 m_data;
+    CLR_OFFSET m_end;           // End of the method's byte code (exception handlers included), see CLR_RT_Assembly::FindMethodBoundaries.
+#if defined(TINYCLR_FRAME_TEMPLATES)
+    CLR_UINT16 m_frameTemplate; // Offset in CLR_RT_Assembly::m_pFrameTemplates, CLR_EmptyIndex if the method has no template.
+#endif
+#if defined(TINYCLR_QUICKENING)
+    CLR_UINT8  m_quickCalls;    // Calls so far, up to CLR_RT_ExecutionEngine::c_QuickeningThreshold, or c_QuickeningNever.
+    CLR_UINT8  m_quickSlot;     // 1-based index in CLR_RT_ExecutionEngine::m_quickened, 0 if the method is not quickened.
+#endif
 
     CLR_IDX    GetOwner () const { return (CLR_IDX)(m_data); }
 };
@@ -718,6 +726,8 @@ struct CLR_RT_UnicodeHelper
     int CountNumberOfCharacters( int max = -1 );
     int CountNumberOfBytes     ( int max = -1 );
 
+    static int CountLeadingASCII( const CLR_UINT8* src, int max );
+
     //--//
 
     bool ConvertFromUTF8( int iMaxChars, bool fJustMove, int iMaxBytes = -1 );
@@ -896,6 +906,10 @@ struct CLR_RT_Assembly : public CLR_RT_HeapBlock_Node // EVENT HEAP - NO RELOCAT
 #if defined(TINYCLR_ENABLE_SOURCELEVELDEBUGGING)
         size_t iDebuggingInfoMethods;
 #endif //#if defined(TINYCLR_ENABLE_SOURCELEVELDEBUGGING)       
+
+#if defined(TINYCLR_FRAME_TEMPLATES)
+        size_t iFrameTemplates;
+#endif
     };
 
     //--//
@@ -941,6 +955,11 @@ struct CLR_RT_Assembly : public CLR_RT_HeapBlock_Node // EVENT HEAP - NO RELOCAT
     CLR_RT_MethodDef_DebuggingInfo  * m_pDebuggingInfo_MethodDef   ; //EVENT HEAP - NO RELOCATION - (but the data they point to has to be relocated)
 #endif //#if defined(TINYCLR_ENABLE_SOURCELEVELDEBUGGING)
 
+#if defined(TINYCLR_FRAME_TEMPLATES)
+    CLR_UINT8*                         m_pFrameTemplates;             // EVENT HEAP - NO RELOCATION - for each method, a header byte followed by the data type of each local.
+    int                                m_iFrameTemplates;
+#endif
+
 #if defined(TINYCLR_TRACE_STACK_HEAVY) && defined(PLATFORM_WINDOWS)
     int                                m_maxOpcodes;
     int*                               m_stackDepth;
@@ -1028,6 +1047,15 @@ struct CLR_RT_Assembly : public CLR_RT_HeapBlock_Node // EVENT HEAP - NO RELOCAT
     CLR_PMETADATA                   GetByteCode    ( CLR_OFFSET i ) { return TINYCLR_ASSEMBLY_RESOLVE(CLR_UINT8               , TBL_ByteCode      , i); }
 #undef TINYCLR_ASSEMBLY_RESOLVE
 
+#if defined(TINYCLR_FRAME_TEMPLATES)
+    CLR_UINT8* GetFrameTemplate( CLR_IDX i )
+    {
+        CLR_UINT16 offset = m_pCrossReference_MethodDef[ i ].m_frameTemplate;
+
+        return offset == CLR_EmptyIndex ? NULL : &m_pFrameTemplates[ offset ];
+    }
+#endif
+
     //--//
 
 #undef DECL_POSTFIX
@@ -1121,6 +1149,8 @@ struct CLR_RT_AppDomain : public CLR_RT_ObjectToEvent_Destination // EVENT HEAP
         AppDomainState_Unloaded
     };
 
+    static const int c_MaxAssemblies = 64; // Same as CLR_RT_TypeSystem::c_MaxAssemblies.
+
     AppDomainState            m_state;
     int                       m_id;
     CLR_RT_DblLinkedList      m_appDomainAssemblies;
@@ -1128,6 +1158,7 @@ struct CLR_RT_AppDomain : public CLR_RT_ObjectToEvent_Destination // EVENT HEAP
     CLR_RT_HeapBlock_String*  m_strName;                     // OBJECT HEAP - DO RELOCATION -
     CLR_RT_HeapBlock*         m_outOfMemoryException;        // OBJECT HEAP - DO RELOCATION -
     CLR_RT_AppDomainAssembly* m_appDomainAssemblyLastAccess; // EVENT HEAP  - NO RELOCATION -
+    CLR_RT_HeapBlock*         m_staticFields[ c_MaxAssemblies ]; // EVENT HEAP  - NO RELOCATION - indexed by CLR_RT_Assembly::m_idx - 1, NULL if the assembly is not loaded in this AppDomain.
     bool                      m_fCanBeUnloaded;
 
     static HRESULT CreateInstance ( LPCSTR szName, CLR_RT_AppDomain*& appDomain);
@@ -1758,6 +1789,15 @@ struct CLR_RT_StackFrame : public CLR_RT_HeapBlock_Node // EVENT HEAP - NO RELOC
     static const int c_OverheadForNewObjOrInteropMethod      =  2; // We need to have more slots in the stack to process a 'newobj' opcode.
     static const int c_MinimumStack                          = 10;
 
+    static const int c_MaxCachedFrames                       =  4; // Frames kept on each thread's free list by Pop.
+
+#if defined(TINYCLR_FRAME_TEMPLATES)
+    static const CLR_UINT8 c_FrameTemplate_Ready             = 0x01;
+    static const CLR_UINT8 c_FrameTemplate_SlowLocals        = 0x02; // Some locals need more than a data type (value types, pinned references).
+    static const CLR_UINT8 c_FrameTemplate_Synchronized      = 0x04;
+    static const CLR_UINT8 c_FrameTemplate_SyncGlobally      = 0x08;
+#endif
+
 
     static const CLR_UINT32 c_MethodKind_Native              = 0x00000000;
     static const CLR_UINT32 c_MethodKind_Interpreted         = 0x00000001;
@@ -2406,6 +2446,7 @@ struct CLR_RT_Thread : public CLR_RT_ObjectToEvent_Destination // EVENT HEAP - N
     CLR_INT32                       m_waitForObject_Result;
 
     CLR_RT_DblLinkedList       m_stackFrames;           // EVENT HEAP - NO RELOCATION - list of CLR_RT_StackFrame
+    CLR_RT_DblLinkedList       m_stackFramesFree;       // EVENT HEAP - NO RELOCATION - list of CLR_RT_StackFrame, recycled by CLR_RT_StackFrame::Push
 
     CLR_RT_DblLinkedList       m_subThreads;            // EVENT HEAP - NO RELOCATION - list of CLR_RT_SubThread
 
@@ -2721,6 +2762,27 @@ extern bool g_CLR_RT_fBadStack;
 
 //--//
 
+#if defined(TINYCLR_QUICKENING)
+
+//
+// Quickened forms of ldfld/stfld, only found in the RAM copies made by CLR_RT_ExecutionEngine::Quickening_Method.
+// The operand is the field offset instead of the field token, so the instruction keeps its original length.
+//
+static const CLR_OPCODE CEE_LDFLD_QUICK = CEE_UNUSED5;
+static const CLR_OPCODE CEE_STFLD_QUICK = CEE_UNUSED6;
+
+struct CLR_RT_QuickenedMethod // EVENT HEAP - NO RELOCATION -
+{
+    CLR_RT_MethodDef_Index m_md;
+    CLR_UINT32             m_lastUsed;
+    CLR_UINT32             m_size;
+    CLR_UINT8              m_code[ 1 ]; // Copy of the byte code, exception handler table included.
+};
+
+#endif
+
+//--//
+
 struct CLR_RT_ExecutionEngine
 {
     static const CLR_UINT32             c_Event_SerialPort  = 0x00000002;
@@ -2743,6 +2805,10 @@ struct CLR_RT_ExecutionEngine
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
 
+    static const int                    c_NumOfTimerThreads        = 2;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+
     static const int                    c_HeapState_Normal         = 0x00000000;
     static const int                    c_HeapState_UnderGC        = 0x00000001;
 
@@ -2825,6 +2891,7 @@ struct CLR_RT_ExecutionEngine
 
     CLR_RT_DblLinkedList   m_appDomains;
     CLR_RT_AppDomain*      m_appDomainCurrent;
+    CLR_RT_HeapBlock**     m_appDomainStaticFields; // CLR_RT_AppDomain::m_staticFields of m_appDomainCurrent.
     int                    m_appDomainIdNext;
 
     CLR_RT_AppDomain* SetCurrentAppDomain( CLR_RT_AppDomain* appDomain );
@@ -2931,11 +2998,13 @@ struct CLR_RT_ExecutionEngine
     CLR_RT_DblLinkedList                m_weakReferences;       // OBJECT HEAP - DO RELOCATION - list of CLR_RT_HeapBlock_WeakReference
 
     CLR_RT_DblLinkedList                m_timers;               // EVENT HEAP - NO RELOCATION - list of CLR_RT_HeapBlock_Timer
+    CLR_RT_DblLinkedList                m_timersTriggered;      // EVENT HEAP - NO RELOCATION - list of CLR_RT_HeapBlock_Timer, ordered by due time
     CLR_UINT32                          m_raisedEvents;
 
     CLR_RT_DblLinkedList                m_threadsReady;         // EVENT HEAP - NO RELOCATION - list of CLR_RT_Thread
     CLR_RT_DblLinkedList                m_threadsWaiting;       // EVENT HEAP - NO RELOCATION - list of CLR_RT_Thread
     CLR_RT_DblLinkedList                m_threadsZombie;        // EVENT HEAP - NO RELOCATION - list of CLR_RT_Thread
+    CLR_RT_DblLinkedList                m_waiterQueues[ CLR_RT_HeapBlock_WaitForObject::c_NumOfWaiterQueues ]; // EVENT HEAP - NO RELOCATION - list of CLR_RT_HeapBlock_WaitForObject::Waiter
     int                                 m_lastPid;
     CLR_RT_Thread*                      m_currentThread;
 
@@ -2951,10 +3020,57 @@ struct CLR_RT_ExecutionEngine
 
     CLR_RT_HeapBlock*                   m_currentUICulture;     // OBJECT HEAP - DO RELOCATION -
 
+#if defined(TINYCLR_BOXING_CACHE)
+    static const int                    c_BoxCache_Range       = BOXING_CACHE_MAX - BOXING_CACHE_MIN + 1;
+
+    //
+    // Boxed instances shared by every box of the same small value, filled on first use.
+    // Nothing can change the value held by a boxed primitive, so sharing them is safe.
+    //
+    CLR_RT_HeapBlock*                   m_boxCacheBoolean[ 2                ]; // OBJECT HEAP - DO RELOCATION -
+    CLR_RT_HeapBlock*                   m_boxCacheChar   [ 128              ]; // OBJECT HEAP - DO RELOCATION -
+    CLR_RT_HeapBlock*                   m_boxCacheUInt8  [ 256              ]; // OBJECT HEAP - DO RELOCATION -
+    CLR_RT_HeapBlock*                   m_boxCacheInt16  [ c_BoxCache_Range ]; // OBJECT HEAP - DO RELOCATION -
+    CLR_RT_HeapBlock*                   m_boxCacheInt32  [ c_BoxCache_Range ]; // OBJECT HEAP - DO RELOCATION -
+
+    CLR_UINT32                          m_boxCacheHits;
+    CLR_UINT32                          m_boxAllocations;
+#endif
+
     //--//
 
     CLR_RT_Thread*                      m_interruptThread;      // EVENT HEAP - NO RELOCATION
-    CLR_RT_Thread*                      m_timerThread;          // EVENT HEAP - NO RELOCATION
+    CLR_RT_Thread*                      m_timerThreads[ c_NumOfTimerThreads ]; // EVENT HEAP - NO RELOCATION
+
+    CLR_UINT32                          m_timerDispatches;
+    CLR_UINT32                          m_timerThreadsReused;   // Dispatches that ran on an existing worker instead of a new thread.
+    CLR_INT64                           m_timerLatencyTotal;    // Sum of (dispatch time - due time), in ticks.
+    CLR_INT64                           m_timerLatencyMax;
+
+    //--//
+
+#if defined(TINYCLR_QUICKENING)
+    static const int                    c_QuickenedSlots       = 32;
+    static const CLR_UINT8              c_QuickeningThreshold  = 16;
+    static const CLR_UINT8              c_QuickeningNever      = 0xFF;
+
+    CLR_RT_QuickenedMethod*             m_quickened[ c_QuickenedSlots ]; // EVENT HEAP - NO RELOCATION -
+    CLR_UINT32                          m_quickenedBytes;
+    CLR_UINT32                          m_quickenedClock;       // Bumped on every call to a quickened method, for LRU eviction.
+    CLR_UINT32                          m_quickenedEvictions;
+#endif
+
+    //--//
+
+#if defined(TINYCLR_PROFILE_OPCODES)
+    static const int                    c_SuperInstruction_LoadField     = 0; // ldarg/ldloc + ldfld
+    static const int                    c_SuperInstruction_AddConstant   = 1; // ldc.i4 + add
+    static const int                    c_SuperInstruction_CompareBranch = 2; // ceq/cgt/clt + brtrue/brfalse
+    static const int                    c_SuperInstruction_Count         = 3;
+
+    CLR_UINT32                          m_opcodeCounts          [ CEE_COUNT                ];
+    CLR_UINT32                          m_superInstructionCounts[ c_SuperInstruction_Count ];
+#endif
 
     //--//
 
@@ -3037,8 +3153,33 @@ struct CLR_RT_ExecutionEngine
     HRESULT InitializeReference( CLR_RT_HeapBlock& ref, CLR_RT_SignatureParser&    parser                        );
     HRESULT InitializeReference( CLR_RT_HeapBlock& ref, const CLR_RECORD_FIELDDEF* target, CLR_RT_Assembly* assm );
 
+    static HRESULT ParseLocal( CLR_PMETADATA& sig, CLR_RT_Assembly* assm, CLR_DataType& dt, CLR_DataType& dtModifier, CLR_RT_TypeDef_Index& cls, CLR_UINT32& levels );
+
     HRESULT InitializeLocals( CLR_RT_HeapBlock* locals, CLR_RT_Assembly* assm, const CLR_RECORD_METHODDEF* md );
 
+#if defined(TINYCLR_FRAME_TEMPLATES)
+    HRESULT InitializeFrameTemplate( CLR_UINT8* tmpl, CLR_RT_Assembly* assm, const CLR_RECORD_METHODDEF* md );
+#endif
+
+#if defined(TINYCLR_QUICKENING)
+    CLR_PMETADATA Quickening_Enter     ( CLR_RT_Assembly* assm, CLR_IDX method, CLR_PMETADATA ipStart );
+    void          Quickening_Deoptimize( CLR_RT_StackFrame* stack, CLR_PMETADATA ip                     );
+    void          Quickening_Cleanup   (                                                                );
+
+private:
+    CLR_RT_QuickenedMethod* Quickening_Method( CLR_RT_Assembly* assm, CLR_IDX method, CLR_PMETADATA ipStart );
+    bool                    Quickening_Evict (                                                          );
+    bool                    Quickening_InUse ( CLR_RT_QuickenedMethod* qm                               );
+    void                    Quickening_Free  ( int slot                                                 );
+
+public:
+#endif
+
+#if defined(TINYCLR_BOXING_CACHE)
+    CLR_RT_HeapBlock** BoxCache_Slot    ( const CLR_RT_TypeDef_Instance& cls, const CLR_RT_HeapBlock& value );
+    void               BoxCache_Relocate(                                                                   );
+#endif
+
     HRESULT NewObjectFromIndex( CLR_RT_HeapBlock& reference, const CLR_RT_TypeDef_Index&    cls                          );
     HRESULT NewObject         ( CLR_RT_HeapBlock& reference, const CLR_RT_TypeDef_Instance& inst                         );
     HRESULT NewObject         ( CLR_RT_HeapBlock& reference, CLR_UINT32                     token, CLR_RT_Assembly* assm );
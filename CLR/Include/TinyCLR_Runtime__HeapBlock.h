@@ -1161,9 +1161,25 @@ public:
     //--//
 
     const CLR_RT_TypeDef_Index& ObjectCls    (                             ) const { return m_data.objectHeader.cls        ; }
-    CLR_RT_HeapBlock_Lock*      ObjectLock   (                             ) const { return m_data.objectHeader.lock       ; }
+    CLR_RT_HeapBlock_Lock*      ObjectLock   (                             ) const { return IsObjectThinLocked() ? NULL : m_data.objectHeader.lock; }
     void                        SetObjectLock( CLR_RT_HeapBlock_Lock* lock )       {        m_data.objectHeader.lock = lock; }
 
+    //
+    // The lock slot of an object header doubles as a thin lock.
+    // Lock blocks live in the event heap and are always word-aligned, so bit 0 tags the slot as a thin lock word,
+    // holding the owner thread id and the recursion count of the thread's base subthread.
+    // The word is handled at pointer width, so a lock pointer on a 64-bit host is never cut down to a thin lock word.
+    //
+    static const CLR_UINT32 c_ThinLock_Flag           = 0x00000001;
+    static const CLR_UINT32 c_ThinLock_RecursionMask  = 0x000000FE;
+    static const CLR_UINT32 c_ThinLock_RecursionUnit  = 0x00000002;
+    static const CLR_UINT32 c_ThinLock_OwnerShift     = 8;
+    static const CLR_UINT32 c_ThinLock_OwnerMask      = 0x00FFFFFF;
+
+    size_t     ObjectLockWord     (                  ) const { return (size_t)m_data.objectHeader.lock                                  ; }
+    bool       IsObjectThinLocked (                  ) const { return (ObjectLockWord() & c_ThinLock_Flag) != 0                        ; }
+    void       SetObjectLockWord  ( size_t word      )       {        m_data.objectHeader.lock = (CLR_RT_HeapBlock_Lock*)word           ; }
+
     HRESULT SetObjectCls( const CLR_RT_TypeDef_Index& cls );
 
     //--//
@@ -1697,6 +1713,21 @@ struct CLR_RT_HeapBlock_String : public CLR_RT_HeapBlock
     static HRESULT                  CreateInstance( CLR_RT_HeapBlock& reference, CLR_UINT16* szText, CLR_UINT32 length     );
 
     static CLR_RT_HeapBlock_String* GetStringEmpty();
+
+    //--//
+
+    //
+    // Strings allocated on the heap keep their hash code in a word between the header and the text.
+    // Zero means it has not been computed yet; strings that live in assembly metadata have no slot.
+    //
+    CLR_UINT32* HashSlot()
+    {
+        CLR_UINT32* slot = (CLR_UINT32*)&this[ 1 ];
+
+        return (StringText() == (LPCSTR)&slot[ 1 ]) ? slot : NULL;
+    }
+
+    CLR_UINT32 HashCode();
 };
 
 struct CLR_RT_HeapBlock_Array : public CLR_RT_HeapBlock
@@ -1727,6 +1758,8 @@ struct CLR_RT_HeapBlock_Array : public CLR_RT_HeapBlock
 
     static bool CheckRange( int index, int length, int numOfElements );
 
+    static CLR_INT32 GrowCapacity( CLR_INT32 capacity, CLR_INT32 min );
+
     static HRESULT IndexOf( CLR_RT_HeapBlock_Array* array, CLR_RT_HeapBlock& match, int start, int stop, bool fForward, int& index );
     static HRESULT Copy( CLR_RT_HeapBlock_Array* arraySrc, int indexSrc, CLR_RT_HeapBlock_Array* arrayDst, int indexDst, int length );
 };
@@ -1880,6 +1913,11 @@ struct CLR_RT_HeapBlock_Lock : public CLR_RT_HeapBlock_Node // EVENT HEAP - NO R
     static HRESULT IncrementOwnership( CLR_RT_HeapBlock_Lock*  lock, CLR_RT_SubThread* sth, const CLR_INT64& timeExpire, bool fForce );
     static HRESULT DecrementOwnership( CLR_RT_HeapBlock_Lock*  lock, CLR_RT_SubThread* sth                                           );
 
+    static CLR_RT_HeapBlock* ThinLock_GetHeader( CLR_RT_HeapBlock& resource                                                    );
+    static bool              ThinLock_TryEnter ( CLR_RT_HeapBlock* obj, CLR_RT_SubThread* sth                                  );
+    static bool              ThinLock_TryExit  ( CLR_RT_HeapBlock* obj, CLR_RT_SubThread* sth                                  );
+    static HRESULT           ThinLock_Inflate  ( CLR_RT_HeapBlock* obj, CLR_RT_HeapBlock& resource, CLR_RT_HeapBlock_Lock*& lock );
+
     void DestroyOwner( CLR_RT_SubThread* sth );
     void ChangeOwner (                       );
 
@@ -2010,11 +2048,26 @@ struct CLR_RT_HeapBlock_EndPoint : public CLR_RT_ObjectToEvent_Destination // EV
 
 struct CLR_RT_HeapBlock_WaitForObject : public CLR_RT_HeapBlock_Node // EVENT HEAP - NO RELOCATION -
 {
+    //
+    // One entry per waited object, queued on the waiter list selected by the address of that object.
+    //
+    struct Waiter : public CLR_RT_HeapBlock_Node // EVENT HEAP - NO RELOCATION -
+    {
+        CLR_RT_HeapBlock_WaitForObject* m_wait;
+        CLR_UINT32                      m_index;
+
+        CLR_RT_HeapBlock* Object() const { return m_wait->GetWaitForObjects()[ m_index ].Dereference(); }
+    };
+
+    static const CLR_UINT32 c_NumOfWaiterQueues = 16;
+
+    CLR_RT_Thread*    m_owningThread; // EVENT HEAP - NO RELOCATION -
     CLR_INT64         m_timeExpire;
     CLR_UINT32        m_cObjects;
     bool              m_fWaitAll;
 
     CLR_RT_HeapBlock* GetWaitForObjects() { return &this[ 1 ]; } // EVENT HEAP - DO RELOCATION -
+    Waiter*           GetWaiters       () { return (Waiter*)&GetWaitForObjects()[ m_cObjects ]; }
 
     //--//
 
@@ -2022,12 +2075,17 @@ struct CLR_RT_HeapBlock_WaitForObject : public CLR_RT_HeapBlock_Node // EVENT HE
     static HRESULT WaitForSignal ( CLR_RT_StackFrame& stack, const CLR_INT64& timeExpire, CLR_RT_HeapBlock* objects, CLR_UINT32 cObjects, bool fWaitAll );    
     static void SignalObject     ( CLR_RT_HeapBlock& object );
 
+    static void InitializeWaiterQueues();
+    static void RelocateWaiterQueues  ();
+
+    void Release ();
     void Relocate();
 
 private:
     static bool    TryWaitForSignal ( CLR_RT_Thread* caller,                              CLR_RT_HeapBlock* objects, CLR_UINT32 cObjects, bool fWaitAll );
-    static void    TryWaitForSignal ( CLR_RT_Thread* caller );
     static HRESULT CreateInstance   ( CLR_RT_Thread* caller, const CLR_INT64& timeExpire, CLR_RT_HeapBlock* objects, CLR_UINT32 cObjects, bool fWaitAll );    
+
+    static CLR_RT_DblLinkedList& WaiterQueue( CLR_RT_HeapBlock* object );
 };
 
 //--//
@@ -2526,6 +2584,10 @@ public:
     HRESULT RemoveAt( CLR_INT32 index );
     HRESULT SetCapacity( CLR_INT32 newCapacity );
 
+    HRESULT AddRange   (                  CLR_RT_HeapBlock_Array* source, CLR_INT32 start, CLR_INT32 count );
+    HRESULT InsertRange( CLR_INT32 index, CLR_RT_HeapBlock_Array* source, CLR_INT32 start, CLR_INT32 count );
+    HRESULT RemoveRange( CLR_INT32 index,                                                  CLR_INT32 count );
+
     //--//
     
     __inline CLR_INT32 GetSize() { return ((CLR_RT_HeapBlock*)this)[ Library_corlib_native_System_Collections_ArrayList__FIELD___size ].NumericByRef().s4; }
@@ -2536,6 +2598,7 @@ private:
     static const CLR_INT32 c_DefaultCapacity = 4;
 
     HRESULT EnsureCapacity( CLR_INT32 min, CLR_INT32 currentCapacity );
+    HRESULT MakeRoom      ( CLR_INT32 index, CLR_INT32 count             );
 
     __inline CLR_RT_HeapBlock_Array* GetItems() { return ((CLR_RT_HeapBlock*)this)[ Library_corlib_native_System_Collections_ArrayList__FIELD___items ].DereferenceArray(); }
     
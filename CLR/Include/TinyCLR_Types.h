@@ -821,10 +821,13 @@ inline CLR_OPCODE CLR_ReadNextOpcodeCompressed( CLR_PMETADATA& ip )
 #if defined(TINYCLR_JITTER) || defined(PLATFORM_WINDOWS)
 
 CLR_PMETADATA CLR_SkipBodyOfOpcode          ( CLR_PMETADATA ip, CLR_OPCODE opcode );
-CLR_PMETADATA CLR_SkipBodyOfOpcodeCompressed( CLR_PMETADATA ip, CLR_OPCODE opcode );
 
 #endif
 
+extern const CLR_UINT8 c_CLR_opParamSizeCompressed[];
+
+CLR_PMETADATA CLR_SkipBodyOfOpcodeCompressed( CLR_PMETADATA ip, CLR_OPCODE opcode );
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 extern bool CLR_SafeSprintfV( LPSTR& szBuffer, size_t& iBuffer, LPCSTR format, va_list arg );
@@ -204,6 +204,7 @@ static const CLR_RT_MethodHandler method_lookup[] =
     Library_corlib_native_System_Collections_ArrayList::set_Item___VOID__I4__OBJECT,
     Library_corlib_native_System_Collections_ArrayList::Add___I4__OBJECT,
     NULL,
+    NULL,
     Library_corlib_native_System_Collections_ArrayList::Clear___VOID,
     NULL,
     NULL,
@@ -215,11 +216,16 @@ static const CLR_RT_MethodHandler method_lookup[] =
     NULL,
     Library_corlib_native_System_Collections_ArrayList::Insert___VOID__I4__OBJECT,
     NULL,
+    NULL,
     Library_corlib_native_System_Collections_ArrayList::RemoveAt___VOID__I4,
+    Library_corlib_native_System_Collections_ArrayList::RemoveRange___VOID__I4__I4,
     NULL,
     NULL,
     NULL,
     Library_corlib_native_System_Collections_ArrayList::SetCapacity___VOID__I4,
+    Library_corlib_native_System_Collections_ArrayList::AddRange___VOID__SZARRAY_OBJECT__I4__I4,
+    Library_corlib_native_System_Collections_ArrayList::InsertRange___VOID__I4__SZARRAY_OBJECT__I4__I4,
+    NULL,
     NULL,
     NULL,
     NULL,
@@ -270,8 +276,6 @@ static const CLR_RT_MethodHandler method_lookup[] =
     NULL,
     NULL,
     NULL,
-    NULL,
-    NULL,
     Library_corlib_native_System_TimeZone::GetTimeZoneOffset___STATIC__I8,
     NULL,
     NULL,
@@ -468,6 +472,8 @@ static const CLR_RT_MethodHandler method_lookup[] =
     NULL,
     NULL,
     Library_corlib_native_System_Number::FormatNative___STATIC__STRING__OBJECT__CHAR__I4,
+    Library_corlib_native_System_Number::ParseInteger___STATIC__I8__STRING__BOOLEAN__I8__I8,
+    Library_corlib_native_System_Number::ParseDouble___STATIC__R8__STRING,
     NULL,
     NULL,
     NULL,
@@ -679,10 +685,14 @@ static const CLR_RT_MethodHandler method_lookup[] =
     NULL,
     NULL,
     NULL,
+    NULL,
+    NULL,
     Library_corlib_native_System_Text_UTF8Decoder::Convert___VOID__SZARRAY_U1__I4__I4__SZARRAY_CHAR__I4__I4__BOOLEAN__BYREF_I4__BYREF_I4__BYREF_BOOLEAN,
     NULL,
     Library_corlib_native_System_Text_UTF8Encoding::GetBytes___SZARRAY_U1__STRING,
     Library_corlib_native_System_Text_UTF8Encoding::GetChars___SZARRAY_CHAR__SZARRAY_U1,
+    Library_corlib_native_System_Text_UTF8Encoding::GetBytes___I4__STRING__I4__I4__SZARRAY_U1__I4,
+    Library_corlib_native_System_Text_UTF8Encoding::GetChars___I4__SZARRAY_U1__I4__I4__SZARRAY_CHAR__I4,
     NULL,
     NULL,
     Library_corlib_native_System_Threading_WaitHandle::WaitOne___BOOLEAN__I4__BOOLEAN,
@@ -797,7 +807,7 @@ static const CLR_RT_MethodHandler method_lookup[] =
 const CLR_RT_NativeAssemblyData g_CLR_AssemblyNative_mscorlib =
 {
     "mscorlib",
-    0xCD5327C1,
+    0xF53B1B50,
     method_lookup
 };
 
@@ -232,7 +232,10 @@ struct Library_corlib_native_System_Collections_ArrayList
     TINYCLR_NATIVE_DECLARE(Clear___VOID);
     TINYCLR_NATIVE_DECLARE(Insert___VOID__I4__OBJECT);
     TINYCLR_NATIVE_DECLARE(RemoveAt___VOID__I4);
+    TINYCLR_NATIVE_DECLARE(RemoveRange___VOID__I4__I4);
     TINYCLR_NATIVE_DECLARE(SetCapacity___VOID__I4);
+    TINYCLR_NATIVE_DECLARE(AddRange___VOID__SZARRAY_OBJECT__I4__I4);
+    TINYCLR_NATIVE_DECLARE(InsertRange___VOID__I4__SZARRAY_OBJECT__I4__I4);
 
     //--//
 
@@ -488,9 +491,20 @@ struct Library_corlib_native_System_Math
 struct Library_corlib_native_System_Number
 {
     TINYCLR_NATIVE_DECLARE(FormatNative___STATIC__STRING__OBJECT__CHAR__I4);
+    TINYCLR_NATIVE_DECLARE(ParseInteger___STATIC__I8__STRING__BOOLEAN__I8__I8);
+    TINYCLR_NATIVE_DECLARE(ParseDouble___STATIC__R8__STRING);
 
     //--//
 
+    static char*   FormatDecimal      ( char* end, CLR_UINT64 value, int minDigits              );
+    static char*   FormatHex          ( char* end, CLR_UINT64 value, int minDigits, bool fUpper );
+#if !defined(TINYCLR_EMULATED_FLOATINGPOINT)
+    static int     FormatFixed        ( char* buffer, double value, int precision );
+    static int     FormatShortest     ( char* buffer, double value, bool fSingle  );
+    static CLR_UINT64 ScaleToInteger  ( double value, int k, double& residue      );
+#endif
+    static HRESULT FormatFloatFallback( char* result, size_t size, CLR_RT_HeapBlock* value, char formatCh, int precision );
+    static bool    SkipBlanks         ( LPCSTR& start, LPCSTR& end );
 };
 
 struct Library_corlib_native_System_Random
@@ -832,6 +846,8 @@ struct Library_corlib_native_System_Text_UTF8Encoding
 {
     TINYCLR_NATIVE_DECLARE(GetBytes___SZARRAY_U1__STRING);
     TINYCLR_NATIVE_DECLARE(GetChars___SZARRAY_CHAR__SZARRAY_U1);
+    TINYCLR_NATIVE_DECLARE(GetBytes___I4__STRING__I4__I4__SZARRAY_U1__I4);
+    TINYCLR_NATIVE_DECLARE(GetChars___I4__SZARRAY_U1__I4__I4__SZARRAY_CHAR__I4);
 
     //--//
 
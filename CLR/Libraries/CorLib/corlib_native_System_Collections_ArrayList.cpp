@@ -84,6 +84,18 @@ HRESULT Library_corlib_native_System_Collections_ArrayList::RemoveAt___VOID__I4(
     TINYCLR_NOCLEANUP();
 }
 
+HRESULT Library_corlib_native_System_Collections_ArrayList::RemoveRange___VOID__I4__I4( CLR_RT_StackFrame& stack )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    TINYCLR_HEADER();
+
+    CLR_RT_HeapBlock_ArrayList* pThis = (CLR_RT_HeapBlock_ArrayList*)stack.This(); FAULT_ON_NULL(pThis);
+
+    TINYCLR_SET_AND_LEAVE(pThis->RemoveRange( stack.Arg1().NumericByRef().s4, stack.Arg2().NumericByRef().s4 ));
+
+    TINYCLR_NOCLEANUP();
+}
+
 HRESULT Library_corlib_native_System_Collections_ArrayList::SetCapacity___VOID__I4( CLR_RT_StackFrame& stack )
 {
     NATIVE_PROFILE_CLR_CORE();
@@ -96,3 +108,27 @@ HRESULT Library_corlib_native_System_Collections_ArrayList::SetCapacity___VOID__
     TINYCLR_NOCLEANUP();
 }
 
+HRESULT Library_corlib_native_System_Collections_ArrayList::AddRange___VOID__SZARRAY_OBJECT__I4__I4( CLR_RT_StackFrame& stack )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    TINYCLR_HEADER();
+
+    CLR_RT_HeapBlock_ArrayList* pThis = (CLR_RT_HeapBlock_ArrayList*)stack.This(); FAULT_ON_NULL(pThis);
+
+    TINYCLR_SET_AND_LEAVE(pThis->AddRange( stack.Arg1().DereferenceArray(), stack.Arg2().NumericByRef().s4, stack.Arg3().NumericByRef().s4 ));
+
+    TINYCLR_NOCLEANUP();
+}
+
+HRESULT Library_corlib_native_System_Collections_ArrayList::InsertRange___VOID__I4__SZARRAY_OBJECT__I4__I4( CLR_RT_StackFrame& stack )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    TINYCLR_HEADER();
+
+    CLR_RT_HeapBlock_ArrayList* pThis = (CLR_RT_HeapBlock_ArrayList*)stack.This(); FAULT_ON_NULL(pThis);
+
+    TINYCLR_SET_AND_LEAVE(pThis->InsertRange( stack.Arg1().NumericByRef().s4, stack.Arg2().DereferenceArray(), stack.Arg3().NumericByRef().s4, stack.Arg4().NumericByRef().s4 ));
+
+    TINYCLR_NOCLEANUP();
+}
+
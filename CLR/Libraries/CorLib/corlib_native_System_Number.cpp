@@ -4,119 +4,811 @@
 
 #include "CorLib.h"
 
+//--//
+
+static const char c_Number_DigitPairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static const char c_Number_HexUpper[] = "0123456789ABCDEF";
+static const char c_Number_HexLower[] = "0123456789abcdef";
+
+static const CLR_UINT64 c_Number_Pow10Int[] =
+{
+    ULONGLONGCONSTANT(1                  ),
+    ULONGLONGCONSTANT(10                 ),
+    ULONGLONGCONSTANT(100                ),
+    ULONGLONGCONSTANT(1000               ),
+    ULONGLONGCONSTANT(10000              ),
+    ULONGLONGCONSTANT(100000             ),
+    ULONGLONGCONSTANT(1000000            ),
+    ULONGLONGCONSTANT(10000000           ),
+    ULONGLONGCONSTANT(100000000          ),
+    ULONGLONGCONSTANT(1000000000         ),
+    ULONGLONGCONSTANT(10000000000        ),
+    ULONGLONGCONSTANT(100000000000       ),
+    ULONGLONGCONSTANT(1000000000000      ),
+    ULONGLONGCONSTANT(10000000000000     ),
+    ULONGLONGCONSTANT(100000000000000    ),
+    ULONGLONGCONSTANT(1000000000000000   ),
+    ULONGLONGCONSTANT(10000000000000000  ),
+    ULONGLONGCONSTANT(100000000000000000 ),
+    ULONGLONGCONSTANT(1000000000000000000),
+};
+
+#if !defined(TINYCLR_EMULATED_FLOATINGPOINT)
+
+//
+// Every power of ten up to 1e22 is exact in a double, so one multiplication or division by it is correctly rounded.
+//
+static const double c_Number_Pow10[] =
+{
+    1e0 , 1e1 , 1e2 , 1e3 , 1e4 , 1e5 , 1e6 , 1e7 , 1e8 , 1e9 , 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+#endif
+
+//--//
+
+char* Library_corlib_native_System_Number::FormatDecimal( char* end, CLR_UINT64 value, int minDigits )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    char*      p = end;
+    CLR_UINT32 v32;
+
+    //
+    // Two digits per division; drop to 32-bit arithmetic as soon as the value fits.
+    //
+    while(value > 0xFFFFFFFFUL)
+    {
+        CLR_UINT64 q = value / 100;
+        CLR_UINT32 r = (CLR_UINT32)(value - q * 100);
+
+        p -= 2; memcpy( p, &c_Number_DigitPairs[ r * 2 ], 2 );
+
+        value = q;
+    }
+
+    v32 = (CLR_UINT32)value;
+
+    while(v32 >= 100)
+    {
+        CLR_UINT32 q = v32 / 100;
+        CLR_UINT32 r = v32 - q * 100;
+
+        p -= 2; memcpy( p, &c_Number_DigitPairs[ r * 2 ], 2 );
+
+        v32 = q;
+    }
+
+    if(v32 >= 10)
+    {
+        p -= 2; memcpy( p, &c_Number_DigitPairs[ v32 * 2 ], 2 );
+    }
+    else
+    {
+        *--p = (char)('0' + v32);
+    }
+
+    while(end - p < minDigits) *--p = '0';
+
+    return p;
+}
+
+char* Library_corlib_native_System_Number::FormatHex( char* end, CLR_UINT64 value, int minDigits, bool fUpper )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    const char* digits = fUpper ? c_Number_HexUpper : c_Number_HexLower;
+    char*       p      = end;
+
+    do
+    {
+        *--p = digits[ (CLR_UINT32)value & 0xF ]; value >>= 4;
+    }
+    while(value);
+
+    while(end - p < minDigits) *--p = '0';
+
+    return p;
+}
+
+#if !defined(TINYCLR_EMULATED_FLOATINGPOINT)
+
+//
+// "F" and "N" formatting: scales by 10^precision and prints the integer and fraction parts.
+// Returns the length written, or -1 if the scaled value does not fit in 64 bits.
+//
+int Library_corlib_native_System_Number::FormatFixed( char* buffer, double value, int precision )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    char       tmp[ 48 ];
+    char*      end = &tmp[ ARRAYSIZE(tmp) ];
+    char*      p;
+    bool       fNegative = (value < 0);
+    double     scaled;
+    CLR_UINT64 n;
+    CLR_UINT64 integral;
+
+    if(precision >= ARRAYSIZE(c_Number_Pow10Int)) return -1;
+
+    if(fNegative) value = -value;
+
+    scaled = value * c_Number_Pow10[ precision ];
+
+    if(!(scaled < 9.0e18)) return -1; // Also rejects NaN.
+
+    n        = (CLR_UINT64)(scaled + 0.5);
+    integral = n / c_Number_Pow10Int[ precision ];
+
+    p = end;
+
+    if(precision > 0)
+    {
+        p = FormatDecimal( p, n - integral * c_Number_Pow10Int[ precision ], precision );
+
+        *--p = '.';
+    }
+
+    p = FormatDecimal( p, integral, 1 );
+
+    if(fNegative) *--p = '-';
+
+    memcpy( buffer, p, end - p );
+
+    return (int)(end - p);
+}
+
+//
+// Rounds value * 10^k to the nearest integer, for 0 <= k <= 22 and a result below 2^63.
+// The product is carried as a rounded double plus its exact error (Dekker's two-product), so the integer is right even
+// past 2^53 and 'residue' returns n - value * 10^k with only the rounding of one final addition.
+//
+CLR_UINT64 Library_corlib_native_System_Number::ScaleToInteger( double value, int k, double& residue )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    const double c_Split = 134217729.0; // 2^27 + 1
+    double       scale   = c_Number_Pow10[ k ];
+    double       product = value * scale;
+    double       t;
+    double       valueHi, valueLo;
+    double       scaleHi, scaleLo;
+    double       frac;
+    CLR_INT64    carry;
+    CLR_UINT64   n;
+
+    t = c_Split * value; valueHi = t - (t - value); valueLo = value - valueHi;
+    t = c_Split * scale; scaleHi = t - (t - scale); scaleLo = scale - scaleHi;
+
+    n    = (CLR_UINT64)product;
+    frac = (product - (double)n) + (((valueHi * scaleHi - product) + valueHi * scaleLo + valueLo * scaleHi) + valueLo * scaleLo);
+
+    //
+    // Past 2^53 the error term can be several units, not just a fraction. Exact halves go to even, as printf does.
+    //
+    t     = frac + 0.5;
+    carry = (CLR_INT64)t; if(carry > t) carry--;
+
+    if(t == (double)carry && ((n + carry) & 1)) carry--;
+
+    n    += carry;
+    frac -= (double)carry;
+
+    residue = -frac;
+
+    return n;
+}
+
+//
+// "G" formatting: the fewest significant digits that parse back to the same value, in the layout of printf's "%g".
+// Returns the length written, or -1 if the value is outside the range where the round trip can be checked exactly.
+//
+int Library_corlib_native_System_Number::FormatShortest( char* buffer, double value, bool fSingle )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    char       tmp[ 24 ];
+    char*      end = &tmp[ ARRAYSIZE(tmp) ];
+    char*      digits;
+    char*      out = buffer;
+    bool       fNegative = (value < 0);
+    int        minPrecision = fSingle ?  6 : 15; // FLT_DIG and DBL_DIG: the shortest form is never longer than these...
+    int        maxPrecision = fSingle ?  9 : 17; // ...when one exists, and 9 or 17 digits always round-trip.
+    int        layout       = fSingle ?  9 : 17; // Exponent threshold used by the "%.9g" and "%.17g" formats this replaces.
+    int        e10;
+    int        precision;
+    int        num;
+    CLR_UINT64 n = 0;
+    CLR_UINT64 bits;
+    double     gapAbove = 0;
+    double     gapBelow = 0;
+
+    if(value == 0)
+    {
+        *out = '0';
+
+        return 1;
+    }
+
+    if(fNegative) value = -value;
+
+    if(!(value >= 1e-5 && value < 1e15)) return -1; // Also rejects NaN and infinities.
+
+    if(!fSingle)
+    {
+        //
+        // Half the distance to the neighbouring doubles: any decimal closer than that reads back as 'value'.
+        // Both are powers of two, and the one below is halved again when 'value' is itself a power of two.
+        //
+        memcpy( &bits, &value, sizeof(bits) );
+
+        bits = ((bits >> 52) - 53) << 52; memcpy( &gapAbove, &bits, sizeof(bits) );
+
+        memcpy( &bits, &value, sizeof(bits) );
+
+        gapBelow = (bits & ULONGLONGCONSTANT(0x000FFFFFFFFFFFFF)) ? gapAbove : gapAbove / 2;
+    }
+
+    //
+    // Estimate the decimal exponent; it is corrected below if the digits come out one short or one long.
+    //
+    if(value >= 1)
+    {
+        for(e10 = 0; value >= c_Number_Pow10[ e10 + 1 ]; e10++);
+    }
+    else
+    {
+        for(e10 = -1; value * c_Number_Pow10[ -e10 ] < 1; e10--);
+    }
+
+    for(precision = minPrecision; precision <= maxPrecision; )
+    {
+        int    k = precision - 1 - e10;
+        double back;
+        bool   fMatch;
+
+        if(k > 22 || k < -22) return -1;
+
+        if(fSingle)
+        {
+            n = (CLR_UINT64)((k >= 0 ? value * c_Number_Pow10[ k ] : value / c_Number_Pow10[ -k ]) + 0.5);
+        }
+        else
+        {
+            double residue;
+            double scale;
+
+            //
+            // A double below 1e15 printed with 15 or more digits always has k >= 0.
+            //
+            if(k < 0) return -1;
+
+            n = ScaleToInteger( value, k, residue );
+
+            //
+            // Ties are rejected rather than resolved to even; that only costs a digit.
+            //
+            scale = c_Number_Pow10[ k ];
+
+            fMatch = (residue >= 0) ? (residue < gapAbove * scale) : (-residue < gapBelow * scale);
+        }
+
+        //
+        // Exactly 10^precision is the rounding carrying into the next decade, not a wrong exponent estimate.
+        //
+        if(n >  c_Number_Pow10Int[ precision     ]) { e10++; continue; }
+        if(n <  c_Number_Pow10Int[ precision - 1 ]) { e10--; continue; }
+
+        if(fSingle)
+        {
+            //
+            // 'n' is below 10^9, so both conversions here are exact and the comparison is a true round-trip check.
+            //
+            back = (k >= 0) ? (double)n / c_Number_Pow10[ k ] : (double)n * c_Number_Pow10[ -k ];
+
+            fMatch = ((float)back == (float)value);
+        }
+
+        if(fMatch)
+        {
+            if(n == c_Number_Pow10Int[ precision ]) { n /= 10; e10++; }
+
+            break;
+        }
+
+        precision++;
+    }
+
+    if(precision > maxPrecision) return -1;
+
+    digits = FormatDecimal( end, n, precision );
+    num    = precision;
+
+    while(num > 1 && digits[ num - 1 ] == '0') num--;
+
+    if(fNegative) *out++ = '-';
+
+    if(e10 < -4 || e10 >= layout)
+    {
+        *out++ = digits[ 0 ];
+
+        if(num > 1)
+        {
+            *out++ = '.'; memcpy( out, &digits[ 1 ], num - 1 ); out += num - 1;
+        }
+
+        *out++ = 'e';
+        *out++ = (e10 < 0) ? '-' : '+';
+
+        if(e10 < 0) e10 = -e10;
+
+        digits = FormatDecimal( end, (CLR_UINT64)e10, 2 );
+        num    = (int)(end - digits);
+
+        memcpy( out, digits, num ); out += num;
+    }
+    else if(e10 >= 0)
+    {
+        int intDigits = e10 + 1;
+
+        if(num <= intDigits)
+        {
+            memcpy( out, digits, num ); out += num;
+
+            while(num++ < intDigits) *out++ = '0';
+        }
+        else
+        {
+            memcpy( out, digits, intDigits ); out += intDigits;
+
+            *out++ = '.'; memcpy( out, &digits[ intDigits ], num - intDigits ); out += num - intDigits;
+        }
+    }
+    else
+    {
+        *out++ = '0';
+        *out++ = '.';
+
+        while(++e10 < 0) *out++ = '0';
+
+        memcpy( out, digits, num ); out += num;
+    }
+
+    return (int)(out - buffer);
+}
+
+#endif
+
+HRESULT Library_corlib_native_System_Number::FormatFloatFallback( char* result, size_t size, CLR_RT_HeapBlock* value, char formatCh, int precision )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    TINYCLR_HEADER();
+
+    // This is temporary buffer to create proper format string.
+    char formatStr[ 8 ];
+
+    if (formatCh == 'G')
+    {
+        hal_snprintf( formatStr, ARRAYSIZE(formatStr), "%%.%dg", (value->DataType() == DATATYPE_R4) ? 9 : 17 ); // "%.9g" for float, "%.17g" for double
+    }
+    else
+    {
+        hal_snprintf( formatStr, ARRAYSIZE(formatStr), "%%.%df", precision ); // i.e. "%#.2f" when precision is 2
+    }
+
+    if(value->DataType() == DATATYPE_R4)
+    {
+#if defined(_WIN32) || defined(WIN32) || defined(_WIN32_WCE)
+        hal_snprintf( result, size, formatStr, value->NumericByRef().r4 );
+#else
+
+#if !defined(TINYCLR_EMULATED_FLOATINGPOINT)
+        float f = value->NumericByRef().r4;
+        hal_snprintf_float( result, size, formatStr, f);
+#else
+        CLR_INT32 f = value->NumericByRef().r4;
+        hal_snprintf_float( result, size, formatStr, f);
+#endif
+
+#endif
+    }
+    else
+    {
+#if defined(_WIN32) || defined(WIN32) || defined(_WIN32_WCE)
+        hal_snprintf( result, size, formatStr, (CLR_DOUBLE_TEMP_CAST)value->NumericByRef().r8 );
+#else
+#if !defined(TINYCLR_EMULATED_FLOATINGPOINT)
+        double d = (CLR_DOUBLE_TEMP_CAST)value->NumericByRef().r8;
+        hal_snprintf_double( result, size, formatStr, d );
+
+#else
+        CLR_INT64 d = (CLR_DOUBLE_TEMP_CAST)value->NumericByRef().r8;
+        hal_snprintf_double( result, size, formatStr, d );
+#endif
+
+#endif
+    }
+
+    TINYCLR_NOCLEANUP_NOLABEL();
+}
+
+//--//
+
 HRESULT Library_corlib_native_System_Number::FormatNative___STATIC__STRING__OBJECT__CHAR__I4( CLR_RT_StackFrame& stack )
 {
     NATIVE_PROFILE_CLR_CORE();
     TINYCLR_HEADER();
 
-    char result[ 256 ];
+    char  result[ 256 ];
+    char* end    = &result[ ARRAYSIZE(result) ];
+    char* start  = result;
+    int   length = -1;
 
     CLR_RT_HeapBlock* pArgs = &(stack.Arg0());
     CLR_RT_HeapBlock* value = pArgs;
-    
+
+    // All the format characters but 'x' have been converted to upper case in the managed layer
+    char formatCh  = (char)pArgs[ 1 ].NumericByRef().u2;
+    int  precision = pArgs[ 2 ].NumericByRef().s4;
+
     CLR_DataType dt;
 
     CLR_RT_TypeDescriptor desc;
     TINYCLR_CHECK_HRESULT(desc.InitializeFromObject( *value ));
     TINYCLR_CHECK_HRESULT(value->PerformUnboxing( desc.m_handlerCls ));
-    
+
+    if (precision < 0 || precision > 99)
+    {
+        TINYCLR_SET_AND_LEAVE( CLR_E_INVALID_PARAMETER );
+    }
 
     dt = value->DataType();
 
     switch(dt)
     {
-    case DATATYPE_I4: 
-        hal_snprintf( result, ARRAYSIZE(result), "%d", value->NumericByRef().s4 ); 
-        break;
-    case DATATYPE_U4: 
-        hal_snprintf( result, ARRAYSIZE(result), "%u", value->NumericByRef().u4 ); 
-        break;
-#if defined(PLATFORM_WINDOWS) || defined(PLATFORM_WINCE)
-    case DATATYPE_I8: 
-        hal_snprintf( result, ARRAYSIZE(result), "%I64d",(CLR_INT64_TEMP_CAST)value->NumericByRef().s8 ); 
-        break;
+    case DATATYPE_I4:
+    case DATATYPE_U4:
+    case DATATYPE_I8:
     case DATATYPE_U8:
-        hal_snprintf( result, ARRAYSIZE(result), "%I64u",(CLR_UINT64_TEMP_CAST)value->NumericByRef().u8 ); 
-        break;
-#else
-    case DATATYPE_I8: 
-        {   // use local 64 bit variable to assure 8-byte boundary.
-            INT64 i64 = (CLR_INT64_TEMP_CAST)value->NumericByRef().s8;
-            hal_snprintf( result, ARRAYSIZE(result), "%lld", i64); 
-        }
-        break;
-    case DATATYPE_U8: 
-        {   // use local 64 bit variable to assure 8-byte boundary.
-            UINT64 ui64 = (CLR_UINT64_TEMP_CAST)value->NumericByRef().u8;
-            hal_snprintf( result, ARRAYSIZE(result), "%llu", ui64 ); 
-        }
-        break;
-#endif
-    case DATATYPE_R4:
-    case DATATYPE_R8:
         {
-            // This is temporary buffer to create proper format string.  
-            char formatStr[ 8 ];
-            char formatCh = (char)pArgs[ 1 ].NumericByRef().u1;
+            CLR_UINT64 bits;
+            CLR_UINT64 magnitude;
+            bool       fNegative = false;
 
-            // All the formatCh have been converted to upper case in the managed layer
-            _ASSERTE(formatCh == 'G' || formatCh == 'N' || formatCh == 'F');
+            switch(dt)
+            {
+            case DATATYPE_I4:
+                bits      = value->NumericByRef().u4;
+                fNegative = value->NumericByRef().s4 < 0;
+                magnitude = fNegative ? (CLR_UINT64)(-(CLR_INT64)value->NumericByRef().s4) : bits;
+                break;
 
-            int precision = pArgs[ 2 ].NumericByRef().s4;
+            case DATATYPE_U4:
+                bits      = value->NumericByRef().u4;
+                magnitude = bits;
+                break;
 
-            if (precision < 0 || precision > 99) 
-            {
-                TINYCLR_SET_AND_LEAVE( CLR_E_INVALID_PARAMETER );
+            case DATATYPE_I8:
+                {   // use local 64 bit variable to assure 8-byte boundary.
+                    CLR_INT64 i64 = (CLR_INT64_TEMP_CAST)value->NumericByRef().s8;
+
+                    bits      = (CLR_UINT64)i64;
+                    fNegative = i64 < 0;
+                    magnitude = fNegative ? (CLR_UINT64)0 - bits : bits;
+                }
+                break;
+
+            default:
+                bits      = (CLR_UINT64_TEMP_CAST)value->NumericByRef().u8;
+                magnitude = bits;
+                break;
             }
 
-            if (formatCh == 'G') 
+            if(formatCh == 'X' || formatCh == 'x')
             {
-                hal_snprintf( formatStr, ARRAYSIZE(formatStr), "%%.%dg", (dt == DATATYPE_R4) ? 9 : 17 ); // "%.9g" for float, "%.17g" for double
+                start = FormatHex( end, bits, precision, formatCh == 'X' );
             }
             else
             {
-                hal_snprintf( formatStr, ARRAYSIZE(formatStr), "%%.%df", precision ); // i.e. "%#.2f" when precision is 2
+                start = FormatDecimal( end, magnitude, formatCh == 'D' ? precision : 1 );
+
+                if(fNegative) *--start = '-';
             }
 
-            if(dt == DATATYPE_R4)
+            length = (int)(end - start);
+        }
+        break;
+
+    case DATATYPE_R4:
+    case DATATYPE_R8:
+        _ASSERTE(formatCh == 'G' || formatCh == 'N' || formatCh == 'F');
+
+#if !defined(TINYCLR_EMULATED_FLOATINGPOINT)
+        {
+            double d = (dt == DATATYPE_R4) ? (double)value->NumericByRef().r4 : (double)(CLR_DOUBLE_TEMP_CAST)value->NumericByRef().r8;
+
+            if(formatCh == 'G')
             {
-#if defined(_WIN32) || defined(WIN32) || defined(_WIN32_WCE)
-                hal_snprintf( result, ARRAYSIZE(result), formatStr, value->NumericByRef().r4 );
-#else
+                length = FormatShortest( result, d, dt == DATATYPE_R4 );
+            }
+            else
+            {
+                length = FormatFixed( result, d, precision );
+            }
+        }
+#endif
+
+        //
+        // Values outside the range of the native printers go through the C runtime.
+        //
+        if(length < 0)
+        {
+            TINYCLR_CHECK_HRESULT(FormatFloatFallback( result, ARRAYSIZE(result), value, formatCh, precision ));
+
+            length = (int)hal_strlen_s( result );
+        }
+        break;
+
+    default:
+        TINYCLR_SET_AND_LEAVE(CLR_E_FAIL);
+    }
+
+    TINYCLR_SET_AND_LEAVE(CLR_RT_HeapBlock_String::CreateInstance( stack.PushValue(), start, length ));
+
+    TINYCLR_NOCLEANUP();
+}
+
+//--//
+
+//
+// The parsers work on the UTF-8 bytes of the string, which for a number are plain ASCII, instead of indexing characters.
+// Blanks around the number are ignored. Returns false if nothing else is left.
+//
+bool Library_corlib_native_System_Number::SkipBlanks( LPCSTR& start, LPCSTR& end )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    end = start + hal_strlen_s( start );
+
+    while(start < end && start[  0 ] == ' ') start++;
+    while(end > start && end  [ -1 ] == ' ') end--;
+
+    return start < end;
+}
+
+HRESULT Library_corlib_native_System_Number::ParseInteger___STATIC__I8__STRING__BOOLEAN__I8__I8( CLR_RT_StackFrame& stack )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    TINYCLR_HEADER();
+
+    LPCSTR     p         = stack.Arg0().RecoverString();
+    bool       fSigned   = stack.Arg1().NumericByRef().u1 != 0;
+    CLR_INT64  min       = (CLR_INT64_TEMP_CAST)stack.Arg2().NumericByRef().s8;
+    CLR_INT64  max       = (CLR_INT64_TEMP_CAST)stack.Arg3().NumericByRef().s8;
+    LPCSTR     end;
+    CLR_UINT64 result    = 0;
+    CLR_UINT64 limit;
+    CLR_INT64  res       = 0;
+    bool       fNegative = false;
+
+    if(p == NULL)
+    {
+        stack.SetResult_I8( res );
+
+        TINYCLR_SET_AND_LEAVE(S_OK);
+    }
+
+    if(SkipBlanks( p, end ) == false) TINYCLR_SET_AND_LEAVE(CLR_E_FAIL);
+
+    if     (*p == '-') { fNegative = true; p++; }
+    else if(*p == '+') {                   p++; }
+
+    if(p == end) TINYCLR_SET_AND_LEAVE(CLR_E_FAIL);
+
+    //
+    // Any value above the limit overflows when multiplied by 10.
+    //
+    limit = fSigned ? ULONGLONGCONSTANT(0x0CCCCCCCCCCCCCCC) : ULONGLONGCONSTANT(0x1999999999999999);
 
+    for(; p < end; p++)
+    {
+        CLR_UINT32 digit = (CLR_UINT32)(*p - '0');
+
+        if(digit > 9 || result > limit) TINYCLR_SET_AND_LEAVE(CLR_E_FAIL);
+
+        result = result * 10 + digit;
+
+        if(result < digit) TINYCLR_SET_AND_LEAVE(CLR_E_FAIL); // The last digit can still wrap an unsigned value around.
+    }
+
+    if(fNegative)
+    {
+        if(fSigned == false && result != 0                 ) TINYCLR_SET_AND_LEAVE(CLR_E_FAIL);
+        if(result > ULONGLONGCONSTANT(0x8000000000000000)) TINYCLR_SET_AND_LEAVE(CLR_E_FAIL);
+
+        res = (CLR_INT64)(0 - result);
+    }
+    else
+    {
+        if(max != 0 && result > ULONGLONGCONSTANT(0x7FFFFFFFFFFFFFFF)) TINYCLR_SET_AND_LEAVE(CLR_E_FAIL);
+
+        res = (CLR_INT64)result;
+    }
+
+    //
+    // A zero maximum stands for UInt64, whose range does not fit the signed check.
+    //
+    if(max != 0 && (res < min || res > max)) TINYCLR_SET_AND_LEAVE(CLR_E_FAIL);
+
+    stack.SetResult_I8( res );
+
+    TINYCLR_NOCLEANUP();
+}
+
+HRESULT Library_corlib_native_System_Number::ParseDouble___STATIC__R8__STRING( CLR_RT_StackFrame& stack )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    TINYCLR_HEADER();
+
+    LPCSTR     p          = stack.Arg0().RecoverString();
+    LPCSTR     end;
+    LPCSTR     digits;
+    CLR_UINT64 mantissa   = 0;
+    int        numDigits  = 0;
+    int        exponent   = 0;
+    bool       fNegative  = false;
+    bool       fDecimal   = false;
+    bool       fAnyDigit  = false;
+    bool       fTruncated = false;
 #if !defined(TINYCLR_EMULATED_FLOATINGPOINT)
-                float f = value->NumericByRef().r4;
-                hal_snprintf_float( result, ARRAYSIZE(result), formatStr, f); 
+    double     value      = 0;
 #else
-                CLR_INT32 f = value->NumericByRef().r4;
-                hal_snprintf_float( result, ARRAYSIZE(result), formatStr, f); 
+    CLR_INT64  value      = 0;
 #endif
 
-#endif
+    if(p == NULL)
+    {
+        stack.SetResult_R8( value );
+
+        TINYCLR_SET_AND_LEAVE(S_OK);
+    }
+
+    if(SkipBlanks( p, end ) == false) TINYCLR_SET_AND_LEAVE(CLR_E_FAIL);
+
+    if     (*p == '-') { fNegative = true; p++; }
+    else if(*p == '+') {                   p++; }
+
+    digits = p;
+
+    //
+    // Up to 19 significant digits are collected in an integer and the decimal exponent is tracked separately,
+    // so the value is scaled, and rounded, only once.
+    //
+    for(; p < end; p++)
+    {
+        CLR_UINT32 digit = (CLR_UINT32)(*p - '0');
+
+        if(digit <= 9)
+        {
+            fAnyDigit = true;
+
+            if(numDigits < 19)
+            {
+                if(mantissa != 0 || digit != 0) // Leading zeros are not significant.
+                {
+                    mantissa = mantissa * 10 + digit;
+                    numDigits++;
+                }
+
+                if(fDecimal) exponent--;
             }
             else
             {
-#if defined(_WIN32) || defined(WIN32) || defined(_WIN32_WCE)
-                hal_snprintf( result, ARRAYSIZE(result), formatStr, (CLR_DOUBLE_TEMP_CAST)value->NumericByRef().r8 );
-#else
+                if(digit != 0) fTruncated = true;
+
+                if(fDecimal == false) exponent++;
+            }
+        }
+        else if(*p == '.' && fDecimal == false)
+        {
+            fDecimal = true;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if(fAnyDigit == false) TINYCLR_SET_AND_LEAVE(CLR_E_FAIL);
+
+    if(p < end)
+    {
+        bool fNegativeExponent = false;
+        int  e                 = 0;
+
+        if(*p != 'e' && *p != 'E') TINYCLR_SET_AND_LEAVE(CLR_E_FAIL);
+
+        if(++p < end && (*p == '-' || *p == '+'))
+        {
+            fNegativeExponent = (*p++ == '-');
+        }
+
+        if(p == end) TINYCLR_SET_AND_LEAVE(CLR_E_FAIL);
+
+        for(; p < end; p++)
+        {
+            CLR_UINT32 digit = (CLR_UINT32)(*p - '0');
+
+            if(digit > 9) TINYCLR_SET_AND_LEAVE(CLR_E_FAIL);
+
+            if(e < 100000) e = e * 10 + digit; // Far outside the range of a double either way.
+        }
+
+        exponent += fNegativeExponent ? -e : e;
+    }
+
+    if(mantissa == 0) exponent = 0;
+
 #if !defined(TINYCLR_EMULATED_FLOATINGPOINT)
-                double d = (CLR_DOUBLE_TEMP_CAST)value->NumericByRef().r8;
-                hal_snprintf_double( result, ARRAYSIZE(result), formatStr, d ); 
+    //
+    // Large exponents are folded into the mantissa while it stays exact in a double.
+    //
+    while(exponent > 22 && mantissa <= ULONGLONGCONSTANT(0x20000000000000) / 10)
+    {
+        mantissa *= 10;
+        exponent--;
+    }
+
+    if(fTruncated == false && mantissa <= ULONGLONGCONSTANT(0x20000000000000) && exponent >= -22 && exponent <= 22)
+    {
+        //
+        // An exact mantissa scaled by an exact power of ten takes a single rounding step, so the result is correctly rounded.
+        //
+        value = (double)(CLR_INT64)mantissa;
+
+        if(exponent >= 0) value *= c_Number_Pow10[  exponent ];
+        else              value /= c_Number_Pow10[ -exponent ];
+    }
+    else
+    {
+        //
+        // The rest needs arbitrary precision to round correctly, which the C runtime's conversion provides.
+        // The text has been validated, strtod stops at the trailing blanks.
+        //
+        value = hal_strtod( digits, NULL );
+    }
 
+    if(!(value <= 1.7976931348623157e308)) TINYCLR_SET_AND_LEAVE(CLR_E_FAIL); // Overflowed to infinity.
 #else
-                CLR_INT64 d = (CLR_DOUBLE_TEMP_CAST)value->NumericByRef().r8;
-                hal_snprintf_double( result, ARRAYSIZE(result), formatStr, d ); 
-#endif
+    {
+        //
+        // Fixed point: digits beyond what the format can hold are dropped, then the value is scaled in integer arithmetic.
+        //
+        const CLR_UINT64 c_MaxMantissa = ULONGLONGCONSTANT(0x7FFFFFFFFFFFFFFF) >> CLR_RT_HeapBlock::HB_DoubleShift;
 
-#endif                
-            }
+        while(exponent < 0 && mantissa > c_MaxMantissa     ) { mantissa /= 10; exponent++; }
+        while(exponent > 0 && mantissa <= c_MaxMantissa / 10) { mantissa *= 10; exponent--; }
+
+        if(exponent > 0 || mantissa > c_MaxMantissa) TINYCLR_SET_AND_LEAVE(CLR_E_FAIL);
+
+        value = (CLR_INT64)(mantissa << CLR_RT_HeapBlock::HB_DoubleShift);
+
+        if(exponent < 0)
+        {
+            value = (-exponent < ARRAYSIZE(c_Number_Pow10Int)) ? value / (CLR_INT64)c_Number_Pow10Int[ -exponent ] : 0;
         }
-        break;
-    default:
-        TINYCLR_SET_AND_LEAVE(CLR_E_FAIL);
     }
+#endif
+
+    if(fNegative) value = -value;
 
-    TINYCLR_SET_AND_LEAVE(stack.SetResult_String( result ));
+    stack.SetResult_R8( value );
 
     TINYCLR_NOCLEANUP();
-}   
+}
@@ -45,6 +45,29 @@ HRESULT Library_corlib_native_System_Text_UTF8Encoding::GetChars___SZARRAY_CHAR_
     
     cBytes     = pArrayBytes->m_numOfElements;
     cBytesCopy = cBytes+1;
+
+    //
+    // Plain ASCII needs neither the zero-terminated copy nor the character count, it is widened straight into the result.
+    //
+    if(CLR_RT_UnicodeHelper::CountLeadingASCII( pArrayBytes->GetFirstElement(), cBytes ) == cBytes)
+    {
+        CLR_RT_UnicodeHelper uh;
+        CLR_RT_HeapBlock&    ret = stack.PushValueAndClear();
+
+        TINYCLR_CHECK_HRESULT(CLR_RT_HeapBlock_Array::CreateInstance( ret, cBytes, g_CLR_RT_WellKnownTypes.m_Char ));
+
+        arrTmp      = ret.DereferenceArray();
+        pArrayBytes = stack.Arg1().DereferenceArray(); // the allocation may have compacted the heap
+
+        uh.SetInputUTF8( (LPCSTR)pArrayBytes->GetFirstElement() );
+
+        uh.m_outputUTF16      = (CLR_UINT16*)arrTmp->GetFirstElement();
+        uh.m_outputUTF16_size = cBytes;
+
+        uh.ConvertFromUTF8( cBytes, false, cBytes );
+
+        TINYCLR_SET_AND_LEAVE(S_OK);
+    }
     
     /* Copy the array to a temporary buffer to create a zero-terminated string */
     TINYCLR_CHECK_HRESULT( CLR_RT_HeapBlock_Array::CreateInstance( ref, cBytesCopy, g_CLR_RT_WellKnownTypes.m_UInt8 ));
@@ -59,3 +82,105 @@ HRESULT Library_corlib_native_System_Text_UTF8Encoding::GetChars___SZARRAY_CHAR_
     TINYCLR_NOCLEANUP();
 }
 
+HRESULT Library_corlib_native_System_Text_UTF8Encoding::GetBytes___I4__STRING__I4__I4__SZARRAY_U1__I4( CLR_RT_StackFrame& stack )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    TINYCLR_HEADER();
+
+    CLR_RT_UnicodeHelper    uh;
+    LPCSTR                  str;
+    const CLR_UINT8*        start;
+    CLR_RT_HeapBlock_Array* pArrayBytes;
+    int                     charIndex;
+    int                     charCount;
+    int                     byteIndex;
+    int                     cBytes;
+
+    str         = stack.Arg1().RecoverString();    FAULT_ON_NULL(str);
+    charIndex   = stack.Arg2().NumericByRef().s4;
+    charCount   = stack.Arg3().NumericByRef().s4;
+    pArrayBytes = stack.Arg4().DereferenceArray(); FAULT_ON_NULL(pArrayBytes);
+    byteIndex   = stack.ArgN( 5 ).NumericByRef().s4;
+
+    _ASSERTE(pArrayBytes->m_typeOfElement == DATATYPE_U1);
+
+    uh.SetInputUTF8( str );
+
+    if(CLR_RT_HeapBlock_Array::CheckRange( charIndex, charCount, uh.CountNumberOfCharacters() ) == false) TINYCLR_SET_AND_LEAVE(CLR_E_OUT_OF_RANGE);
+
+    //
+    // The string is stored as UTF-8 already, the requested characters are located in place and copied as they are.
+    //
+    uh.ConvertFromUTF8( charIndex, true ); start = uh.m_inputUTF8;
+    uh.ConvertFromUTF8( charCount, true );
+
+    cBytes = (int)(uh.m_inputUTF8 - start);
+
+    if(CLR_RT_HeapBlock_Array::CheckRange( byteIndex, cBytes, pArrayBytes->m_numOfElements ) == false) TINYCLR_SET_AND_LEAVE(CLR_E_INVALID_PARAMETER);
+
+    memcpy( pArrayBytes->GetElement( byteIndex ), start, cBytes );
+
+    stack.SetResult_I4( cBytes );
+
+    TINYCLR_NOCLEANUP();
+}
+
+HRESULT Library_corlib_native_System_Text_UTF8Encoding::GetChars___I4__SZARRAY_U1__I4__I4__SZARRAY_CHAR__I4( CLR_RT_StackFrame& stack )
+{
+    NATIVE_PROFILE_CLR_CORE();
+    TINYCLR_HEADER();
+
+    CLR_RT_UnicodeHelper    uh;
+    CLR_RT_HeapBlock_Array* pArrayBytes;
+    CLR_RT_HeapBlock_Array* pArrayChars;
+    const CLR_UINT8*        byteStart;
+    int                     byteIndex;
+    int                     byteCount;
+    int                     charIndex;
+    int                     cChars;
+
+    pArrayBytes = stack.Arg1().DereferenceArray(); FAULT_ON_NULL(pArrayBytes);
+    byteIndex   = stack.Arg2().NumericByRef().s4;
+    byteCount   = stack.Arg3().NumericByRef().s4;
+    pArrayChars = stack.Arg4().DereferenceArray(); FAULT_ON_NULL(pArrayChars);
+    charIndex   = stack.ArgN( 5 ).NumericByRef().s4;
+
+    _ASSERTE(pArrayBytes->m_typeOfElement == DATATYPE_U1);
+    _ASSERTE(pArrayChars->m_typeOfElement == DATATYPE_CHAR);
+
+    if(CLR_RT_HeapBlock_Array::CheckRange( byteIndex, byteCount, pArrayBytes->m_numOfElements ) == false ||
+       CLR_RT_HeapBlock_Array::CheckRange( charIndex, 0        , pArrayChars->m_numOfElements ) == false  )
+    {
+        TINYCLR_SET_AND_LEAVE(CLR_E_OUT_OF_RANGE);
+    }
+
+    byteStart = pArrayBytes->GetElement( byteIndex );
+
+    //
+    // Every byte other than a continuation byte starts a character, four byte sequences start a surrogate pair.
+    // Sizing the output exactly also keeps the transcoder from writing its terminator into the caller's array.
+    //
+    cChars = CLR_RT_UnicodeHelper::CountLeadingASCII( byteStart, byteCount );
+
+    for(int i = cChars; i < byteCount; i++)
+    {
+        CLR_UINT8 b = byteStart[ i ];
+
+        if((b & 0xC0) != 0x80) cChars++;
+        if( b         >= 0xF0) cChars++;
+    }
+
+    if(cChars > (CLR_INT32)pArrayChars->m_numOfElements - charIndex) TINYCLR_SET_AND_LEAVE(CLR_E_INVALID_PARAMETER);
+
+    uh.SetInputUTF8( (LPCSTR)byteStart );
+
+    uh.m_outputUTF16      = (CLR_UINT16*)pArrayChars->GetElement( charIndex );
+    uh.m_outputUTF16_size = cChars;
+
+    uh.ConvertFromUTF8( cChars, false, byteCount );
+
+    stack.SetResult_I4( cChars - uh.m_outputUTF16_size );
+
+    TINYCLR_NOCLEANUP();
+}
+
@@ -18,6 +18,8 @@ static const CLR_RT_MethodHandler method_lookup[] =
     Library_spot_net_security_native_Microsoft_SPOT_Net_Security_SslNative::ExitSecureContext___STATIC__I4__I4,
     Library_spot_net_security_native_Microsoft_SPOT_Net_Security_SslNative::ParseCertificate___STATIC__VOID__SZARRAY_U1__STRING__BYREF_STRING__BYREF_STRING__BYREF_mscorlibSystemDateTime__BYREF_mscorlibSystemDateTime,
     Library_spot_net_security_native_Microsoft_SPOT_Net_Security_SslNative::DataAvailable___STATIC__I4__OBJECT,
+    Library_spot_net_security_native_Microsoft_SPOT_Net_Security_SslNative::SetOption___STATIC__BOOLEAN__I4__I4__I4,
+    Library_spot_net_security_native_Microsoft_SPOT_Net_Security_SslNative::SessionReused___STATIC__I4__OBJECT,
     NULL,
     NULL,
     NULL,
@@ -31,7 +33,7 @@ static const CLR_RT_MethodHandler method_lookup[] =
 const CLR_RT_NativeAssemblyData g_CLR_AssemblyNative_Microsoft_SPOT_Net_Security =
 {
     "Microsoft.SPOT.Net.Security", 
-    0xCE14C821,
+    0x7243509A,
     method_lookup
 };
 
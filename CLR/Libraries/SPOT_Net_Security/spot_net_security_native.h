@@ -18,6 +18,8 @@ struct Library_spot_net_security_native_Microsoft_SPOT_Net_Security_SslNative
     TINYCLR_NATIVE_DECLARE(ExitSecureContext___STATIC__I4__I4);
     TINYCLR_NATIVE_DECLARE(ParseCertificate___STATIC__VOID__SZARRAY_U1__STRING__BYREF_STRING__BYREF_STRING__BYREF_mscorlibSystemDateTime__BYREF_mscorlibSystemDateTime);
     TINYCLR_NATIVE_DECLARE(DataAvailable___STATIC__I4__OBJECT);
+    TINYCLR_NATIVE_DECLARE(SetOption___STATIC__BOOLEAN__I4__I4__I4);
+    TINYCLR_NATIVE_DECLARE(SessionReused___STATIC__I4__OBJECT);
 
     //--//
 
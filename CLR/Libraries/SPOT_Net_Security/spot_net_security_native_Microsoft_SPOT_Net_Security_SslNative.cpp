@@ -427,6 +427,38 @@ HRESULT Library_spot_net_security_native_Microsoft_SPOT_Net_Security_SslNative::
     TINYCLR_NOCLEANUP();    
 }
 
+HRESULT Library_spot_net_security_native_Microsoft_SPOT_Net_Security_SslNative::SetOption___STATIC__BOOLEAN__I4__I4__I4( CLR_RT_StackFrame& stack )
+{
+    NATIVE_PROFILE_CLR_NETWORK();
+    TINYCLR_HEADER();
+
+    CLR_INT32 sslContext = stack.Arg0().NumericByRef().s4;
+    CLR_INT32 option     = stack.Arg1().NumericByRef().s4;
+    CLR_INT32 value      = stack.Arg2().NumericByRef().s4;
+
+    stack.SetResult_Boolean( SSL_SetOption( sslContext, option, value ) == TRUE );
+
+    TINYCLR_NOCLEANUP_NOLABEL();
+}
+
+HRESULT Library_spot_net_security_native_Microsoft_SPOT_Net_Security_SslNative::SessionReused___STATIC__I4__OBJECT( CLR_RT_StackFrame& stack )
+{
+    NATIVE_PROFILE_CLR_NETWORK();
+    TINYCLR_HEADER();
+
+    CLR_RT_HeapBlock* socket = stack.Arg0().Dereference();
+    CLR_INT32 handle;
+
+    FAULT_ON_NULL(socket);
+
+    handle = socket[ Library_spot_net_native_Microsoft_SPOT_Net_SocketNative::FIELD__m_Handle ].NumericByRef().s4;
+
+    // negative when the socket has no SSL session or the driver cannot tell
+    stack.SetResult_I4( SSL_SessionReused( handle ) );
+
+    TINYCLR_NOCLEANUP();
+}
+
 //--//
 
 HRESULT Library_spot_net_security_native_Microsoft_SPOT_Net_Security_SslNative::ReadWriteHelper( CLR_RT_StackFrame& stack, bool isWrite )
@@ -115,3 +115,23 @@ HRESULT Library_spot_net_security_native_Microsoft_SPOT_Net_Security_SslNative::
     TINYCLR_NOCLEANUP();
 }
 
+HRESULT Library_spot_net_security_native_Microsoft_SPOT_Net_Security_SslNative::SetOption___STATIC__BOOLEAN__I4__I4__I4( CLR_RT_StackFrame& stack )
+{
+    NATIVE_PROFILE_CLR_NETWORK();
+    TINYCLR_HEADER();
+
+    TINYCLR_SET_AND_LEAVE(stack.NotImplementedStub());
+
+    TINYCLR_NOCLEANUP();
+}
+
+HRESULT Library_spot_net_security_native_Microsoft_SPOT_Net_Security_SslNative::SessionReused___STATIC__I4__OBJECT( CLR_RT_StackFrame& stack )
+{
+    NATIVE_PROFILE_CLR_NETWORK();
+    TINYCLR_HEADER();
+
+    TINYCLR_SET_AND_LEAVE(stack.NotImplementedStub());
+
+    TINYCLR_NOCLEANUP();
+}
+
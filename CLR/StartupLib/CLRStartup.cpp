@@ -54,6 +54,15 @@ struct Settings
         TINYCLR_CHECK_HRESULT(CLR_RT_ExecutionEngine::CreateInstance());
 #if !defined(BUILD_RTM)
         CLR_Debug::Printf( "Created EE.\r\n" );
+
+        //
+        // Test runs log the interpreter's dispatch mode, so the results of the two builds of the same suite can be told apart.
+        //
+#if defined(TINYCLR_THREADED_DISPATCH)
+        CLR_Debug::Printf( "Interpreter: threaded dispatch.\r\n" );
+#else
+        CLR_Debug::Printf( "Interpreter: switch dispatch.\r\n" );
+#endif
 #endif
 
 #if !defined(BUILD_RTM)
@@ -64,10 +64,17 @@ unsigned
 short   enc28j60_lwip_read_phy_register(SPI_CONFIGURATION *spiConf, 
                                               UINT8 registerAddress);
 
+static 
+UINT8   enc28j60_lwip_packet_count(SPI_CONFIGURATION *spiConf);
+
 /* keep track of the receive pointer */    
 static unsigned short s_ENC28J60_TRANSMIT_BUFFER_START = ENC28J60_TRANSMIT_BUFFER_START;
 static unsigned short s_ENC28J60_RECEIVE_BUFFER_START  = ENC28J60_RECEIVE_BUFFER_START;
 
+#define ENC28J60_RECEIVE_BUFFER_SIZE (ENC28J60_RECEIVE_BUFFER_END - ENC28J60_RECEIVE_BUFFER_START + 1)
+
+ENC28J60_LWIP_RECV_STATS g_ENC28J60_LWIP_RecvStats;
+
 
 /* ********************************************************************
    open the ENC28J60 driver interface.
@@ -83,6 +90,8 @@ bool enc28j60_lwip_open( struct netif *pNetIF )
 {
     NATIVE_PROFILE_HAL_DRIVERS_ETHERNET();
 
+    memset(&g_ENC28J60_LWIP_RecvStats, 0, sizeof(g_ENC28J60_LWIP_RecvStats));
+
     return enc28j60_lwip_setup_device( pNetIF );
 }
 
@@ -250,8 +259,7 @@ void enc28j60_lwip_interrupt( struct netif *pNetIF )
     
     /* Read the number of packets remaining */
     
-    enc28j60_lwip_select_bank(SpiConf, ENC28J60_CONTROL_REGISTER_BANK1);
-    enc28j60_lwip_read_spi(SpiConf, ENC28J60_SPI_READ_BUFFER_MEMORY_OPCODE, ENC28J60_EPKTCNT, &cntPkts, 1, 0);  
+    cntPkts = enc28j60_lwip_packet_count(SpiConf);
     
     
     if ((status & (1 << ENC28J60_ESTAT_INT)) || cntPkts)
@@ -273,12 +281,24 @@ void enc28j60_lwip_interrupt( struct netif *pNetIF )
         /* recover from rx error */
         if (eirData & (1 << ENC28J60_EIR_RXERIF_BIT))
         {
+            g_ENC28J60_LWIP_RecvStats.RingOverflows++;
+
             enc28j60_handle_recv_error( pNetIF, SpiConf );
         }
 
         if (cntPkts)
         {
+            /* INTIE stays clear until the end of this routine, so the pre interrupt
+               can not start an SPI transaction in the middle of a frame read; the
+               receive path takes the lock itself, around its register updates only */
+            byteData = (1 << ENC28J60_EIE_INTIE_BIT);
+            enc28j60_lwip_write_spi(SpiConf, ENC28J60_SPI_BIT_FIELD_CLEAR_OPCODE, ENC28J60_EIE, byteData);
+
+            encIrq.Release();
+
             packetsLeft = enc28j60_lwip_recv( pNetIF );
+
+            encIrq.Acquire();
         }
     }
     
@@ -315,13 +335,69 @@ void enc28j60_lwip_interrupt( struct netif *pNetIF )
 }
 
 /* ********************************************************************
-   Receive. a packet over the packet driver interface.  This is called
+   Read the number of packets waiting in the receive ring.
+
+   FROM ERRATA: EIR.PKTIF does not reliably report pending packets,
+   EPKTCNT does.  It is an ETH register, so it is read with the read
+   control register command; this leaves bank 1 selected.
+
+  ******************************************************************** */
+static UINT8 enc28j60_lwip_packet_count( SPI_CONFIGURATION* SpiConf )
+{
+    UINT8 cntPkts;
+
+    enc28j60_lwip_select_bank(SpiConf, ENC28J60_CONTROL_REGISTER_BANK1);
+    enc28j60_lwip_read_spi(SpiConf, ENC28J60_SPI_READ_CONTROL_REGISTER_OPCODE, ENC28J60_EPKTCNT, &cntPkts, 1, 0);
+
+    return cntPkts;
+}
+
+/* ********************************************************************
+   Record how much of the receive ring is waiting to be read, from the
+   hardware write pointer.  Bank 0 must be selected.
+
+  ******************************************************************** */
+static void enc28j60_lwip_update_ring_usage( SPI_CONFIGURATION* SpiConf )
+{
+    UINT8   byteData;
+    UINT16  writePointer;
+    UINT32  used;
+
+    enc28j60_lwip_read_spi(SpiConf, ENC28J60_SPI_READ_CONTROL_REGISTER_OPCODE, ENC28J60_ERXWRPTL, &byteData, 1, 0);
+    writePointer = byteData;
+    enc28j60_lwip_read_spi(SpiConf, ENC28J60_SPI_READ_CONTROL_REGISTER_OPCODE, ENC28J60_ERXWRPTH, &byteData, 1, 0);
+    writePointer |= byteData << 8;
+
+    if(writePointer >= s_ENC28J60_RECEIVE_BUFFER_START)
+    {
+        used = writePointer - s_ENC28J60_RECEIVE_BUFFER_START;
+    }
+    else
+    {
+        used = writePointer + ENC28J60_RECEIVE_BUFFER_SIZE - s_ENC28J60_RECEIVE_BUFFER_START;
+    }
+
+    g_ENC28J60_LWIP_RecvStats.RingUsed = used;
+
+    if(used > g_ENC28J60_LWIP_RecvStats.RingHighWater)
+    {
+        g_ENC28J60_LWIP_RecvStats.RingHighWater = used;
+    }
+}
+
+/* ********************************************************************
+   Receive. the packets waiting in the receive ring.  This is called
    from the ISR or task ISR.
    
-   This routine is called when a packet is received. 
-    
-   Upon successful reading of received packet, the IP is
-   signalled to process the packet.
+   Packets are read in bursts of up to ENC28J60_RECV_BURST.  ERDPT is
+   set once per burst; after that each packet is one buffer memory read
+   that runs on into the header of the next one, ERDPT wrapping at the
+   end of the ring by itself.  The ring space of the whole burst is
+   released before its packets are handed to the stack, so the chip can
+   refill it while the stack works.
+
+   Interrupts are only disabled while ERDPT, ERXRDPT and PKTDEC are
+   updated, not while the frames themselves are read.
    
    Returns the number of packets that remain to be processed
 
@@ -331,13 +407,19 @@ int enc28j60_lwip_recv( struct netif *pNetIF )
     NATIVE_PROFILE_HAL_DRIVERS_ETHERNET();
 
     struct pbuf        *pPBuf;
-    UINT8              *dataRX;
-    UINT8               nextPktAndRecvStatusVector[6];
+    struct pbuf        *burst[ENC28J60_RECV_BURST];
+    UINT8               nextPktAndRecvStatusVector[ENC28J60_RECV_HEADER_SIZE];
     UINT16              length;
+    UINT16              span;
+    UINT16              trailer;
+    UINT16              payloadStart;
     UINT8               byteData;
     UINT8               packetsLeft;
     UINT16              lastReceiveBuffer;
     SPI_CONFIGURATION*  SpiConf;
+    int                 cntRead;
+    int                 cntBurst;
+    int                 i;
     
     int                     numPacketsProcessed = 0;
     
@@ -348,15 +430,21 @@ int enc28j60_lwip_recv( struct netif *pNetIF )
 
     SpiConf = &g_ENC28J60_LWIP_Config.DeviceConfigs[0].SPI_Config;
 
-    do 
+    packetsLeft = enc28j60_lwip_packet_count(SpiConf);
+
+    while (packetsLeft)
     {
+        cntRead  = 0;
+        cntBurst = 0;
+
         {
-            /* Disable interrupt for each loop and only each loop */
             GLOBAL_LOCK(encIrq);
 
-            /* Set the read buffer pointer to the beginning of the packet */
             enc28j60_lwip_select_bank(SpiConf, ENC28J60_CONTROL_REGISTER_BANK0);
-            
+
+            enc28j60_lwip_update_ring_usage(SpiConf);
+
+            /* Set the read buffer pointer to the beginning of the packet */
             byteData = s_ENC28J60_RECEIVE_BUFFER_START & 0xFF;
             
             enc28j60_lwip_write_spi(SpiConf, ENC28J60_SPI_WRITE_CONTROL_REGISTER_OPCODE, ENC28J60_ERDPTL, byteData);
@@ -364,60 +452,102 @@ int enc28j60_lwip_recv( struct netif *pNetIF )
             byteData = (s_ENC28J60_RECEIVE_BUFFER_START  >> 8) & 0xFF;
             
             enc28j60_lwip_write_spi(SpiConf, ENC28J60_SPI_WRITE_CONTROL_REGISTER_OPCODE, ENC28J60_ERDPTH, byteData);
+        }
 
-            /* Get the next packet pointer */
-            enc28j60_lwip_read_spi(SpiConf, ENC28J60_SPI_READ_BUFFER_MEMORY_OPCODE, 
-                                ENC28J60_SPI_READ_BUFFER_MEMORY_ARGUMENT, 
-                                nextPktAndRecvStatusVector, 6, 0);   
-            
+        /* Get the next packet pointer */
+        enc28j60_lwip_read_spi(SpiConf, ENC28J60_SPI_READ_BUFFER_MEMORY_OPCODE, 
+                            ENC28J60_SPI_READ_BUFFER_MEMORY_ARGUMENT, 
+                            nextPktAndRecvStatusVector, ENC28J60_RECV_HEADER_SIZE, 0);   
+
+        while((cntRead < packetsLeft) && (cntRead < ENC28J60_RECV_BURST))
+        {
             lastReceiveBuffer = (nextPktAndRecvStatusVector[1] << 8) | nextPktAndRecvStatusVector[0];
             length = (nextPktAndRecvStatusVector[3] << 8) | nextPktAndRecvStatusVector[2];
 
+            /* the frame and its padding fill the ring up to the next packet */
+            payloadStart = s_ENC28J60_RECEIVE_BUFFER_START + ENC28J60_RECV_HEADER_SIZE;
+
+            if(payloadStart > ENC28J60_RECEIVE_BUFFER_END)
+            {
+                payloadStart -= ENC28J60_RECEIVE_BUFFER_SIZE;
+            }
+
+            if(lastReceiveBuffer >= payloadStart)
+            {
+                span = lastReceiveBuffer - payloadStart;
+            }
+            else
+            {
+                span = lastReceiveBuffer + ENC28J60_RECEIVE_BUFFER_SIZE - payloadStart;
+            }
+
             /* corrupted */
-            if(lastReceiveBuffer > ENC28J60_RECEIVE_BUFFER_END)
+            if((lastReceiveBuffer > ENC28J60_RECEIVE_BUFFER_END) || (length > ENC28J60_MAXIMUM_FRAME_SIZE) || (span < length))
             {
+                GLOBAL_LOCK(encIrq);
+
+                g_ENC28J60_LWIP_RecvStats.RingResets++;
+
                 enc28j60_handle_recv_error( pNetIF, SpiConf);
                 packetsLeft = 0;
+                cntRead     = 0;
                 break;
             }
-            else
+
+            s_ENC28J60_RECEIVE_BUFFER_START = lastReceiveBuffer;
+            cntRead++;
+
+            /* carry on into the header of the next packet of this burst */
+            trailer = ((cntRead < packetsLeft) && (cntRead < ENC28J60_RECV_BURST)) ? ENC28J60_RECV_HEADER_SIZE : 0;
+
+            pPBuf = pbuf_alloc( PBUF_RAW, span + trailer, PBUF_RAM );
+
+            if ( !pPBuf )
             {
-                s_ENC28J60_RECEIVE_BUFFER_START = lastReceiveBuffer;
+                g_ENC28J60_LWIP_RecvStats.AllocDrops++;
+
+                hal_printf("enc28j60_lwip_recv: input alloc packet failed \r\n");
+
+                /* ERDPT is still at this packet, the next burst starts over from the next one */
+                break;
+            }
+
+            /* Get the packet */
+            enc28j60_lwip_read_spi(SpiConf, ENC28J60_SPI_READ_BUFFER_MEMORY_OPCODE, 
+                            ENC28J60_SPI_READ_BUFFER_MEMORY_ARGUMENT, 
+                            (UINT8 *)pPBuf->payload, 
+                            span + trailer, 
+                            0);   
+
+            if(trailer)
+            {
+                memcpy(nextPktAndRecvStatusVector, (UINT8 *)pPBuf->payload + span, ENC28J60_RECV_HEADER_SIZE);
+            }
+
+            //remove the checksum trailing bytes
+            if (length > 63)
+            {
+                length -= 4;
             }
 
             if (length != 0)
             {
-                pPBuf = pbuf_alloc( PBUF_RAW, length, PBUF_RAM );
-                
-                if ( pPBuf )
-                {
-                   dataRX = (UINT8 *)pPBuf->payload;
-
-                    //remove the checksum trailing bytes
-                    if (length > 63)
-                    {
-                        length -= 4;
-                    }
-                    
-                    /* Get the packet */
-                    enc28j60_lwip_read_spi(SpiConf, ENC28J60_SPI_READ_BUFFER_MEMORY_OPCODE, 
-                                    ENC28J60_SPI_READ_BUFFER_MEMORY_ARGUMENT, 
-                                    dataRX, 
-                                    length, 
-                                    0);   
-                
-                    /* invoke stack ip input - the stack should free the buffer when it is done,
-                                        so DON'T call pbuf_free on pPBuf!!!!!*/
-                    pNetIF->input( pPBuf, pNetIF );
-                }
-                else
-                {
-                    hal_printf("enc28j60_lwip_recv: input alloc packet failed \r\n");
-                }   
+                pbuf_realloc( pPBuf, length );
+
+                burst[cntBurst++] = pPBuf;
             }
-            else // no packets left - should we break??
+            else
             {
+                pbuf_free( pPBuf );
             }
+        }
+
+        if(cntRead)
+        {
+            GLOBAL_LOCK(encIrq);
+
+            /* ERXRDPT is in bank 0 */
+            enc28j60_lwip_select_bank(SpiConf, ENC28J60_CONTROL_REGISTER_BANK0);
 
             if(0 == (s_ENC28J60_RECEIVE_BUFFER_START % 2))
             {
@@ -433,32 +563,47 @@ int enc28j60_lwip_recv( struct netif *pNetIF )
                 }
             }
             else
-            {
+            {
                 lastReceiveBuffer = s_ENC28J60_RECEIVE_BUFFER_START;
             }
 
-            /* Free the packet from the ethernet */            
+            /* Free the packets of this burst from the ethernet */            
             byteData = lastReceiveBuffer & 0xFF;
             enc28j60_lwip_write_spi(SpiConf, ENC28J60_SPI_WRITE_CONTROL_REGISTER_OPCODE, ENC28J60_ERXRDPTL, byteData);
             
             byteData = lastReceiveBuffer >> 8;
             enc28j60_lwip_write_spi(SpiConf, ENC28J60_SPI_WRITE_CONTROL_REGISTER_OPCODE, ENC28J60_ERXRDPTH, byteData);
                                   
-            /* the host controller must write a 1 to the ECON2.PKTDEC bit. 
+            /* the host controller must write a 1 to the ECON2.PKTDEC bit for each packet. 
                          Doing so will cause the EPKTCNT register to decrement by 1 */
             byteData = (1 << ENC28J60_ECON2_PKTDEC_BIT);
-            enc28j60_lwip_write_spi(SpiConf, ENC28J60_SPI_BIT_FIELD_SET_OPCODE, ENC28J60_ECON2, byteData); 
-            
-            /* Read the number of packets remaining*/
-            enc28j60_lwip_select_bank(SpiConf, ENC28J60_CONTROL_REGISTER_BANK1);
-            enc28j60_lwip_read_spi(SpiConf, ENC28J60_SPI_READ_BUFFER_MEMORY_OPCODE, ENC28J60_EPKTCNT, &packetsLeft, 1, 0);   
 
-            if ( (++numPacketsProcessed > CFG_MAX_PACKETS_PROCESSED) && packetsLeft)
+            for(i = 0; i < cntRead; i++)
             {
-                break;
+                enc28j60_lwip_write_spi(SpiConf, ENC28J60_SPI_BIT_FIELD_SET_OPCODE, ENC28J60_ECON2, byteData); 
             }
+            
+            /* Read the number of packets remaining*/
+            packetsLeft = enc28j60_lwip_packet_count(SpiConf);
+        }
+
+        /* invoke stack ip input - the stack should free the buffers when it is done,
+                            so DON'T call pbuf_free on them!!!!!*/
+        for(i = 0; i < cntBurst; i++)
+        {
+            pNetIF->input( burst[i], pNetIF );
         }
-    } while (packetsLeft);    
+
+        g_ENC28J60_LWIP_RecvStats.Frames += cntBurst;
+        g_ENC28J60_LWIP_RecvStats.Bursts++;
+
+        numPacketsProcessed += cntRead;
+
+        if ( (numPacketsProcessed >= CFG_MAX_PACKETS_PROCESSED) || (cntRead == 0) )
+        {
+            break;
+        }
+    }
         
     return packetsLeft;
     
@@ -576,7 +721,7 @@ err_t enc28j60_lwip_xmit( struct netif *pNetIF, struct pbuf *pPBuf)
         pPBuf = pPBuf->next;
     }
 
-    CPU_SPI_nWrite8_nRead8(*SpiConf, pTx, length+2, 0, 0, 0 );
+    ENC28J60_SPI_nWrite8_nRead8(*SpiConf, pTx, length+2, 0, 0, 0 );
 
     pbuf_free(pTmp);
 
@@ -1007,7 +1152,7 @@ void enc28j60_lwip_write_spi(SPI_CONFIGURATION *spiConf,
     commandWithData[0] = opcodeArg;
     commandWithData[1] = byteData;
     
-    CPU_SPI_nWrite8_nRead8 (*spiConf, commandWithData, 2, 0, 0, 0);
+    ENC28J60_SPI_nWrite8_nRead8 (*spiConf, commandWithData, 2, 0, 0, 0);
 }
 
 /* void enc28j60_lwip_soft_reset(SPI_CONFIGURATION *spiConf)
@@ -1065,7 +1210,7 @@ void enc28j60_lwip_soft_reset(SPI_CONFIGURATION* spiConf)
     /* Combine the command and the data */
     byteData = (ENC28J60_SPI_SYSTEM_COMMAND_SOFT_RESET_OPCODE << 5) | 
                 ENC28J60_SPI_SYSTEM_COMMAND_SOFT_RESET_ARGUMENT;
-    CPU_SPI_nWrite8_nRead8 (*spiConf, (UINT8 *)&byteData, 1, 0, 0, 0);
+    ENC28J60_SPI_nWrite8_nRead8 (*spiConf, (UINT8 *)&byteData, 1, 0, 0, 0);
 
     /* Errata : After reset wait for 100 ms */
     for(byteData=0; byteData<100; byteData++)
@@ -1109,8 +1254,8 @@ void enc28j60_lwip_read_spi(SPI_CONFIGURATION *spiConf,
     
     opcodeArg = ENC28J60_SPI_OPCODE_ARGUMENT(opcode, address);
     
-    /* Write the command and read*/
-    CPU_SPI_nWrite8_nRead8 (*spiConf, &opcodeArg, 1, byteData, numBytes+offset, offset+1);
+    /* Write the command and read, skipping the command byte and any dummy bytes */
+    ENC28J60_SPI_nWrite8_nRead8 (*spiConf, &opcodeArg, 1, byteData, numBytes, offset+1);
 }
 
 
@@ -24,6 +24,34 @@ void        enc28j60_lwip_pre_interrupt (GPIO_PIN Pin, BOOL PinState, void *pArg
 void        enc28j60_lwip_setup_recv_buffer( struct netif *pNetIF, SPI_CONFIGURATION  *SpiConf);
 
 
+/*          SPI BACK END                                                */
+
+/* Defining ENC28J60_LWIP_SPI_SIMULATION sends the driver's SPI traffic to the
+   chip model in Test\Native\Src\ENC28J60 instead of the SPI controller, so
+   the receive path can be measured on the host */
+#if defined(ENC28J60_LWIP_SPI_SIMULATION)
+BOOL        ENC28J60_Simulator_nWrite8_nRead8( const SPI_CONFIGURATION& Configuration, UINT8* Write8, INT32 WriteCount, UINT8* Read8, INT32 ReadCount, INT32 ReadStartOffset );
+#define     ENC28J60_SPI_nWrite8_nRead8     ENC28J60_Simulator_nWrite8_nRead8
+#else
+#define     ENC28J60_SPI_nWrite8_nRead8     CPU_SPI_nWrite8_nRead8
+#endif
+
+/*          RECEIVE STATISTICS                                          */
+
+struct ENC28J60_LWIP_RECV_STATS
+{
+    UINT32  Frames;             /* frames handed to the stack */
+    UINT32  Bursts;             /* ring reads that delivered them */
+    UINT32  RingUsed;           /* bytes waiting in the receive ring at the last burst */
+    UINT32  RingHighWater;      /* most bytes ever seen waiting in the receive ring */
+    UINT32  RingOverflows;      /* RXERIF events: the ring or EPKTCNT was full and frames were dropped */
+    UINT32  AllocDrops;         /* frames dropped for lack of a pbuf */
+    UINT32  RingResets;         /* corrupt packet headers that forced a receiver reset */
+};
+
+extern ENC28J60_LWIP_RECV_STATS g_ENC28J60_LWIP_RecvStats;
+
+
 /*          FUNCTION PROTOTYPE                                          */
 
 
@@ -39,8 +67,11 @@ void        enc28j60_lwip_setup_recv_buffer( struct netif *pNetIF, SPI_CONFIGURA
 
 /*              ENC28J60 CONFIGURATION                                  */
 #define     CFG_NUM_ENC28J60            NETWORK_INTERFACE_COUNT                                    
-#define     CFG_MAX_PACKETS_PROCESSED   10          /* The maximum number of packets to process in one
-                                                        shot */
+#define     CFG_MAX_PACKETS_PROCESSED   64          /* The maximum number of packets to process in one
+                                                        shot, more than a full receive ring holds */
+#define     ENC28J60_RECV_BURST         8           /* packets read from the ring before any is handed
+                                                        to the stack */
+#define     ENC28J60_RECV_HEADER_SIZE   6           /* next packet pointer and receive status vector */
 
 #define     ENC28J60_FULL_DUPLEX        0           /* DON'T CHANGE adds support for full duplex */
 #define     ENC28J60_MAXIMUM_FRAME_SIZE 1530        /* maximum frame sizes to be transmitted */
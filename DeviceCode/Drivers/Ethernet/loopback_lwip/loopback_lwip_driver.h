@@ -36,4 +36,33 @@ struct LOOPBACK_LWIP_Driver
     static BOOL Bind   (   void          );
 };
 
+//--//
+
+/* The virtual wire is a pair of Ethernet netifs joined back to back, so traffic between its
+   two addresses goes through ARP, Ethernet framing and a deferred receive like a real link
+   instead of being short circuited by the stack's loopback. Enabled by NETWORK_USE_VIRTUAL_WIRE,
+   see readme.txt in this directory. */
+#define VIRTUAL_WIRE_NEAR_ADDR(ip)      IP4_ADDR(ip, 10,254,0,1)
+#define VIRTUAL_WIRE_FAR_ADDR(ip)       IP4_ADDR(ip, 10,254,0,2)
+#define VIRTUAL_WIRE_NETMASK(ip)        IP4_ADDR(ip, 255,255,255,0)
+
+#define VIRTUAL_WIRE_MTU                1500
+#define VIRTUAL_WIRE_QUEUE_DEPTH        32
+
+struct VIRTUAL_WIRE_LWIP_STATS
+{
+    UINT32 Frames;
+    UINT32 QueueHighWater;
+    UINT32 QueueDrops;
+    UINT32 AllocDrops;
+};
+
+extern VIRTUAL_WIRE_LWIP_STATS g_VIRTUAL_WIRE_LWIP_Stats;
+
+struct VIRTUAL_WIRE_LWIP_Driver
+{
+    static BOOL Open   (   void          );
+    static BOOL Close  (   void          );
+};
+
 #endif /* _LOOPBACK_LWIP_DRIVER_H_ */
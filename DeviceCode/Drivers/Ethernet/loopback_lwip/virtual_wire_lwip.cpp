@@ -0,0 +1,206 @@
+#include <tinyhal.h>
+#include "net_decl.h"
+#include "loopback_lwip_driver.h"
+
+#include "netif\etharp.h"
+
+//--//
+
+#define VIRTUAL_WIRE_ENDS               2
+#define VIRTUAL_WIRE_MAX_FRAMES_PER_RUN 16
+
+struct VIRTUAL_WIRE_FRAME
+{
+    struct pbuf*  Frame;
+    struct netif* Destination;
+};
+
+#if defined(ADS_LINKER_BUG__NOT_ALL_UNUSED_VARIABLES_ARE_REMOVED)
+#pragma arm section zidata = "g_VIRTUAL_WIRE_LWIP_Driver"
+#endif
+
+VIRTUAL_WIRE_LWIP_Driver g_VIRTUAL_WIRE_LWIP_Driver;
+VIRTUAL_WIRE_LWIP_STATS  g_VIRTUAL_WIRE_LWIP_Stats;
+
+struct netif             g_VirtualWire_NetIF[VIRTUAL_WIRE_ENDS];
+
+static VIRTUAL_WIRE_FRAME s_VirtualWire_Queue[VIRTUAL_WIRE_QUEUE_DEPTH];
+static UINT32             s_VirtualWire_Head;
+static UINT32             s_VirtualWire_Count;
+static HAL_CONTINUATION   s_VirtualWire_Continuation;
+
+#if defined(ADS_LINKER_BUG__NOT_ALL_UNUSED_VARIABLES_ARE_REMOVED)
+#pragma arm section zidata
+#endif
+
+static const unsigned char c_VirtualWire_HwAddr[VIRTUAL_WIRE_ENDS][ETHARP_HWADDR_LEN] =
+{
+    { 0x02, 0x00, 0x0a, 0xfe, 0x00, 0x01 },
+    { 0x02, 0x00, 0x0a, 0xfe, 0x00, 0x02 },
+};
+
+//--//
+
+static void virtual_wire_lwip_deliver( void* arg )
+{
+    NATIVE_PROFILE_HAL_DRIVERS_ETHERNET();
+
+    /* Deliver a bounded number of frames per run, the replies they generate are queued behind
+       them and picked up by the next run so other continuations get a turn in between. */
+    for(int i = 0; i < VIRTUAL_WIRE_MAX_FRAMES_PER_RUN; i++)
+    {
+        VIRTUAL_WIRE_FRAME frame;
+
+        {
+            GLOBAL_LOCK(irq);
+
+            if(s_VirtualWire_Count == 0) break;
+
+            frame = s_VirtualWire_Queue[s_VirtualWire_Head];
+
+            if(++s_VirtualWire_Head == VIRTUAL_WIRE_QUEUE_DEPTH) s_VirtualWire_Head = 0;
+
+            s_VirtualWire_Count--;
+        }
+
+        if(frame.Destination->input( frame.Frame, frame.Destination ) != ERR_OK)
+        {
+            pbuf_free( frame.Frame );
+        }
+    }
+
+    {
+        GLOBAL_LOCK(irq);
+
+        if(s_VirtualWire_Count != 0 && !s_VirtualWire_Continuation.IsLinked())
+        {
+            s_VirtualWire_Continuation.Enqueue();
+        }
+    }
+
+    HAL_SOCK_EventsSet( SOCKET_EVENT_FLAG_SOCKET );
+}
+
+static err_t virtual_wire_lwip_xmit( struct netif* pNetIF, struct pbuf* pPBuf )
+{
+    NATIVE_PROFILE_HAL_DRIVERS_ETHERNET();
+
+    struct netif* peer = (pNetIF == &g_VirtualWire_NetIF[0]) ? &g_VirtualWire_NetIF[1] : &g_VirtualWire_NetIF[0];
+    struct pbuf*  frame;
+
+    /* The caller keeps ownership of pPBuf, so the frame is copied onto the wire as it would be into a controller's buffer */
+    frame = pbuf_alloc( PBUF_RAW, pPBuf->tot_len, PBUF_RAM );
+
+    if(frame == NULL)
+    {
+        g_VIRTUAL_WIRE_LWIP_Stats.AllocDrops++;
+
+        return ERR_OK;
+    }
+
+    pbuf_copy( frame, pPBuf );
+
+    GLOBAL_LOCK(irq);
+
+    if(s_VirtualWire_Count == VIRTUAL_WIRE_QUEUE_DEPTH)
+    {
+        g_VIRTUAL_WIRE_LWIP_Stats.QueueDrops++;
+
+        pbuf_free( frame );
+
+        return ERR_OK;
+    }
+
+    VIRTUAL_WIRE_FRAME& entry = s_VirtualWire_Queue[(s_VirtualWire_Head + s_VirtualWire_Count) % VIRTUAL_WIRE_QUEUE_DEPTH];
+
+    entry.Frame       = frame;
+    entry.Destination = peer;
+
+    s_VirtualWire_Count++;
+
+    g_VIRTUAL_WIRE_LWIP_Stats.Frames++;
+
+    if(s_VirtualWire_Count > g_VIRTUAL_WIRE_LWIP_Stats.QueueHighWater)
+    {
+        g_VIRTUAL_WIRE_LWIP_Stats.QueueHighWater = s_VirtualWire_Count;
+    }
+
+    if(!s_VirtualWire_Continuation.IsLinked())
+    {
+        s_VirtualWire_Continuation.Enqueue();
+    }
+
+    return ERR_OK;
+}
+
+static err_t virtual_wire_lwip_init( struct netif* pNetIF )
+{
+    int end = (pNetIF == &g_VirtualWire_NetIF[0]) ? 0 : 1;
+
+    pNetIF->mtu        = VIRTUAL_WIRE_MTU;
+    pNetIF->hwaddr_len = ETHARP_HWADDR_LEN;
+    pNetIF->flags     |= NETIF_FLAG_BROADCAST | NETIF_FLAG_ETHARP | NETIF_FLAG_POINTTOPOINT | NETIF_FLAG_LINK_UP | NETIF_FLAG_VIRTUAL_WIRE;
+
+    memcpy( pNetIF->hwaddr, c_VirtualWire_HwAddr[end], ETHARP_HWADDR_LEN );
+
+    pNetIF->output     = etharp_output;
+    pNetIF->linkoutput = virtual_wire_lwip_xmit;
+
+    return ERR_OK;
+}
+
+//--//
+
+BOOL VIRTUAL_WIRE_LWIP_Driver::Open( )
+{
+    NATIVE_PROFILE_HAL_DRIVERS_ETHERNET();
+
+    struct ip_addr near_addr, far_addr, netmask;
+
+    VIRTUAL_WIRE_NEAR_ADDR(&near_addr);
+    VIRTUAL_WIRE_FAR_ADDR (&far_addr );
+    VIRTUAL_WIRE_NETMASK  (&netmask  );
+
+    memset( &g_VIRTUAL_WIRE_LWIP_Stats, 0, sizeof(g_VIRTUAL_WIRE_LWIP_Stats) );
+
+    s_VirtualWire_Head  = 0;
+    s_VirtualWire_Count = 0;
+
+    s_VirtualWire_Continuation.InitializeCallback( (HAL_CALLBACK_FPN)virtual_wire_lwip_deliver, NULL );
+
+    /* Each end's gateway is the other end, which makes it the point to point route to its peer */
+    if(netif_add( &g_VirtualWire_NetIF[0], &near_addr, &netmask, &far_addr , NULL, virtual_wire_lwip_init, ethernet_input ) == NULL) return FALSE;
+    if(netif_add( &g_VirtualWire_NetIF[1], &far_addr , &netmask, &near_addr, NULL, virtual_wire_lwip_init, ethernet_input ) == NULL) return FALSE;
+
+    netif_set_up( &g_VirtualWire_NetIF[0] );
+    netif_set_up( &g_VirtualWire_NetIF[1] );
+
+    return TRUE;
+}
+
+BOOL VIRTUAL_WIRE_LWIP_Driver::Close( )
+{
+    NATIVE_PROFILE_HAL_DRIVERS_ETHERNET();
+
+    s_VirtualWire_Continuation.Abort();
+
+    for(int i = 0; i < VIRTUAL_WIRE_ENDS; i++)
+    {
+        netif_set_down( &g_VirtualWire_NetIF[i] );
+
+        netif_remove( &g_VirtualWire_NetIF[i] );
+    }
+
+    while(s_VirtualWire_Count != 0)
+    {
+        pbuf_free( s_VirtualWire_Queue[s_VirtualWire_Head].Frame );
+
+        if(++s_VirtualWire_Head == VIRTUAL_WIRE_QUEUE_DEPTH) s_VirtualWire_Head = 0;
+
+        s_VirtualWire_Count--;
+    }
+
+    memset( g_VirtualWire_NetIF, 0, sizeof(g_VirtualWire_NetIF) );
+
+    return TRUE;
+}
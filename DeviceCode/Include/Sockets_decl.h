@@ -154,6 +154,7 @@ typedef int SOCK_SOCKET;
 #define SOCK_SOCK_PACK_EX    6       
 
 #define SOCK_TCP_NODELAY  0x0001
+#define SOCK_TCP_SEGMENTS_SENT 0x7101     // get only: segments with data, SYN or FIN the connection has sent
 
 #define SOCK_IPPROTO_IP                                 0
 #define SOCK_IPPROTO_ICMP                               1
@@ -322,6 +323,11 @@ typedef struct SOCK_discoveryinfo
 #define SOCKET_READ_PEEK_OPTION             2
 #endif 
 
+// SocketFlags.Partial on a send: more data follows immediately, the stack may hold this data back to fill segments
+#ifndef SOCKET_WRITE_PARTIAL_OPTION
+#define SOCKET_WRITE_PARTIAL_OPTION         0x8000
+#endif 
+
 #ifndef DEBUG_SOCKET_PORT
 #define DEBUG_SOCKET_PORT                   26000
 #endif
@@ -660,6 +666,13 @@ void SSL_GetTime(DATE_TIME_INFO* pdt);
 void SSL_RegisterTimeCallback(SSL_DATE_TIME_FUNC pfn);
 BOOL SSL_ParseCertificate( const char* certificate, size_t certLength, const char* szPwd, X509CertData* certData );
 int  SSL_DataAvailable( int socket );
+BOOL SSL_SetOption( int sslContextHandle, int option, int value );
+int  SSL_SessionReused( int socket );
+
+// SSL_SetOption options; the session cache sizes are driver wide and ignore sslContextHandle
+#define SSL_OPTION__CLIENT_SESSION_CACHE 1
+#define SSL_OPTION__SERVER_SESSION_CACHE 2
+#define SSL_OPTION__READ_AHEAD           3
 
 //--//
 
@@ -15,6 +15,7 @@
 #include "..\..\test\native\src\gpio\gpio.h"
 #include "..\..\test\native\src\spi\spi.h"
 #include "..\..\test\native\src\ramtest\ramtest.h"
+#include "..\..\test\native\src\ENC28J60\enc28j60_sim.h"
 
 //--//
 
@@ -41,6 +41,8 @@ int hal_snprintf( char* buffer, size_t len, const char* format, ... );
 #if !defined(PLATFORM_EMULATED_FLOATINGPOINT)
 int hal_snprintf_float( char* buffer, size_t len, const char* format, float f );
 int hal_snprintf_double( char* buffer, size_t len, const char* format, double d );
+
+double hal_strtod( const char* str, char** endptr );
 #else
 int hal_snprintf_float( char* buffer, size_t len, const char* format, INT32 f );
 int hal_snprintf_double( char* buffer, size_t len, const char* format, INT64& d );
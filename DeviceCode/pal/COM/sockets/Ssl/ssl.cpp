@@ -486,3 +486,16 @@ INT32 SSL_DataAvailable( SOCK_SOCKET socket )
     return avail;    
 }
 
+// RTSSL exposes neither its session cache nor its session handles
+BOOL SSL_SetOption( INT32 sslContextHandle, INT32 option, INT32 value )
+{
+    NATIVE_PROFILE_PAL_COM();
+    return FALSE;
+}
+
+INT32 SSL_SessionReused( SOCK_SOCKET socket )
+{
+    NATIVE_PROFILE_PAL_COM();
+    return SOCK_SOCKET_ERROR;
+}
+
@@ -142,3 +142,14 @@ INT32 SSL_DataAvailable( SOCK_SOCKET socket )
     return ssl_pending_internal(socket);
 }
 
+BOOL SSL_SetOption( INT32 sslContextHandle, INT32 option, INT32 value )
+{
+    NATIVE_PROFILE_PAL_COM();
+    return ssl_set_option_internal(sslContextHandle, option, value);
+}
+
+INT32 SSL_SessionReused( SOCK_SOCKET socket )
+{
+    return ssl_session_reused_internal(socket);
+}
+
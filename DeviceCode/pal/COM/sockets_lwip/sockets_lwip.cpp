@@ -4,6 +4,11 @@
 
 #include "sockets_lwip.h"
 
+#if defined(HAL_PROFILE_ENABLED)
+#include "lwip\stats.h"
+#include "lwip\dns.h"
+#endif
+
 //--//
 
 #if defined(ADS_LINKER_BUG__NOT_ALL_UNUSED_VARIABLES_ARE_REMOVED)
@@ -741,6 +746,16 @@ extern struct netif g_Loopback_NetIF;
 
 void Sockets_LWIP_Driver::TCP_IP_Thread_ContinuationRoutine(void* arg)
 {
+    // posts made from here on need a new run, the mailbox may already have been drained
+    g_Sockets_LWIP_Driver.m_TCP_IP_runQueued = FALSE;
+
+#if defined(HAL_PROFILE_ENABLED)
+    if(++g_Sockets_LWIP_Driver.m_TCP_IP_wakeups == c_TCP_IP_ProfileInterval)
+    {
+        DumpTcpIpProfile();
+    }
+#endif
+
     // call back lwIP
     g_Sockets_LWIP_Driver.m_TCP_IP_state_machine_callback(arg);
 
@@ -765,12 +780,53 @@ void Sockets_LWIP_Driver::TCP_IP_Thread_ContinuationRoutine(void* arg)
     }
 }
 
+#if defined(HAL_PROFILE_ENABLED)
+
+// prints how often the tcpip thread ran for the packets the link moved since the last dump, then starts a new window;
+// the DNS table counters are running totals, for sizing DNS_TABLE_SIZE and DNS_NEGATIVE_TTL
+void Sockets_LWIP_Driver::DumpTcpIpProfile()
+{
+    UINT32 runs    = g_Sockets_LWIP_Driver.m_TCP_IP_wakeups;
+    UINT32 packets = 0;
+
+#if LWIP_STATS && LINK_STATS
+    // the lwIP counters may be 16 bits wide, so each one is differenced at its own width
+    packets += (STAT_COUNTER)(lwip_stats.link.recv - (STAT_COUNTER)g_Sockets_LWIP_Driver.m_TCP_IP_linkRecv);
+    packets += (STAT_COUNTER)(lwip_stats.link.xmit - (STAT_COUNTER)g_Sockets_LWIP_Driver.m_TCP_IP_linkXmit);
+
+    g_Sockets_LWIP_Driver.m_TCP_IP_linkRecv = lwip_stats.link.recv;
+    g_Sockets_LWIP_Driver.m_TCP_IP_linkXmit = lwip_stats.link.xmit;
+#endif
+
+    if(packets != 0)
+    {
+        UINT32 perPacket = runs * 100 / packets;
+
+        debug_printf("TCPIP: %u runs, %u coalesced restarts, %u packets, %u.%02u runs per packet\r\n",
+                     runs, g_Sockets_LWIP_Driver.m_TCP_IP_coalescedRestarts, packets, perPacket / 100, perPacket % 100);
+    }
+    else
+    {
+        debug_printf("TCPIP: %u runs, %u coalesced restarts\r\n", runs, g_Sockets_LWIP_Driver.m_TCP_IP_coalescedRestarts);
+    }
+
+#if LWIP_DNS
+    debug_printf("DNS: %u lookups answered from the table, %u queries sent\r\n", dns_cache_hits, dns_cache_misses);
+#endif
+
+    g_Sockets_LWIP_Driver.m_TCP_IP_wakeups           = 0;
+    g_Sockets_LWIP_Driver.m_TCP_IP_coalescedRestarts = 0;
+}
+
+#endif
+
 void Sockets_LWIP_Driver::CreateTcpIpProcessor(HAL_CALLBACK_FPN callback, void* arg)
 {
     // remember where to call back into lwIP
     g_Sockets_LWIP_Driver.m_TCP_IP_state_machine_callback = callback;
     // now initizlie our callback
     g_Sockets_LWIP_Driver.m_TCP_IP_state_machine.InitializeForUserMode(&Sockets_LWIP_Driver::TCP_IP_Thread_ContinuationRoutine, arg);
+    g_Sockets_LWIP_Driver.m_TCP_IP_runQueued = FALSE;
     g_Sockets_LWIP_Driver.m_TCP_IP_state_machine.EnqueueDelta(1000);
 }
 
@@ -782,10 +838,20 @@ void Sockets_LWIP_Driver::RestartTcpIpProcessor(UINT32 timeFromNow_us)
     
     if(timeFromNow_us == 0)
     {
+        // the pending run drains the whole mailbox, so every post until it starts rides on it
+        if(g_Sockets_LWIP_Driver.m_TCP_IP_runQueued)
+        {
+#if defined(HAL_PROFILE_ENABLED)
+            g_Sockets_LWIP_Driver.m_TCP_IP_coalescedRestarts++;
+#endif
+            return;
+        }
+
         if(isLinked) 
         {
             g_Sockets_LWIP_Driver.m_TCP_IP_state_machine.Abort();
         }
+        g_Sockets_LWIP_Driver.m_TCP_IP_runQueued = TRUE;
         g_Sockets_LWIP_Driver.m_TCP_IP_state_machine.Enqueue();
     }
     else if(!isLinked)
@@ -852,6 +918,7 @@ BOOL Sockets_LWIP_Driver::Uninitialize( )
 
         g_Sockets_LWIP_Driver.m_TCP_IP_timer.Abort();
         g_Sockets_LWIP_Driver.m_TCP_IP_state_machine.Abort();
+        g_Sockets_LWIP_Driver.m_TCP_IP_runQueued = FALSE;
         
         g_Sockets_LWIP_Driver.m_stateDebugSocket = DbgSock_Uninitialized;
 
@@ -170,11 +170,24 @@ private:
     static void SaveWirelessConfig(INT32 index, SOCK_NetworkConfiguration *cfg);
 
     static void TCP_IP_Thread_ContinuationRoutine(void* arg);
+#if defined(HAL_PROFILE_ENABLED)
+    static void DumpTcpIpProfile();
+#endif
     
     static HAL_COMPLETION s_DebuggerTimeoutCompletion;
     HAL_COMPLETION   m_TCP_IP_state_machine;
     HAL_CALLBACK_FPN m_TCP_IP_state_machine_callback;
     HAL_COMPLETION   m_TCP_IP_timer;
+    BOOL             m_TCP_IP_runQueued;         // an immediate run of the tcpip thread is already pending
+
+#if defined(HAL_PROFILE_ENABLED)
+    UINT32           m_TCP_IP_wakeups;           // runs of the tcpip thread since the last profile dump
+    UINT32           m_TCP_IP_coalescedRestarts; // restarts absorbed by an already pending run
+    UINT32           m_TCP_IP_linkRecv;          // link packet counters at the last profile dump
+    UINT32           m_TCP_IP_linkXmit;
+
+    static const UINT32 c_TCP_IP_ProfileInterval = 1000; // tcpip runs between two profile dumps
+#endif
 
     SOCK_SOCKET    m_SocketDebugListener;
     SOCK_SOCKET    m_SocketDebugStream;
@@ -41,6 +41,9 @@
 #include <stdlib.h>
 #endif
 
+/* TINYCLR_SSL_AES_CONSTANT_TIME builds the bitsliced code in aes_ct.c instead */
+#ifndef TINYCLR_SSL_AES_CONSTANT_TIME
+
 #ifndef AES_ASM
 /*
 Te0[x] = S [x].[02, 01, 01, 03];
@@ -1358,3 +1361,5 @@ int AES_set_decrypt_key(const unsigned char *userKey, const int bits,
 }
 
 #endif /* AES_ASM */
+
+#endif /* !TINYCLR_SSL_AES_CONSTANT_TIME */
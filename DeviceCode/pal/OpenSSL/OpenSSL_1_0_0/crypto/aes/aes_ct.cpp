@@ -0,0 +1,494 @@
+/* crypto/aes/aes_ct.c */
+/*
+ * Constant-time AES for the TinyCLR port.
+ *
+ * The table driven code in aes_core.c indexes its tables with key and data
+ * dependent values, which leaks timing through the data cache on the parts
+ * that have one.  This implementation is bitsliced instead: the state is
+ * held as eight 32-bit words, one per bit position, with two blocks side by
+ * side, and the S-box is the Boyar-Peralta circuit evaluated on all 32 bytes
+ * at once.  There are no lookups and no branches on secret data.
+ *
+ * The AES_KEY holds the compressed bitsliced schedule (4 words per round key,
+ * so it fits rd_key as is); it is expanded on the stack for each block.  The
+ * same schedule serves encryption and decryption.
+ *
+ * Built instead of aes_core.c when TINYCLR_SSL_AES_CONSTANT_TIME is defined.
+ *
+ * The bitsliced S-box, the orthogonalization and the key schedule are taken
+ * from BearSSL (aes_ct.c, aes_ct_enc.c and aes_ct_dec.c) and remain under
+ * its license:
+ *
+ * Copyright (c) 2016 Thomas Pornin <pornin@bolet.org>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <openssl/aes.h>
+#include <openssl/crypto.h>
+#include "aes_locl.h"
+#include <tinyclr/ssl_types.h>
+#ifdef OPENSSL_SYS_WINDOWS
+#include <assert.h>
+#include <stdlib.h>
+#endif
+
+#ifdef TINYCLR_SSL_AES_CONSTANT_TIME
+
+#define GETU32LE(p) ((u32)(p)[0] ^ ((u32)(p)[1] << 8) ^ ((u32)(p)[2] << 16) ^ ((u32)(p)[3] << 24))
+#define PUTU32LE(ct, st) { (ct)[0] = (u8)(st); (ct)[1] = (u8)((st) >> 8); (ct)[2] = (u8)((st) >> 16); (ct)[3] = (u8)((st) >> 24); }
+
+static void aes_ct_sbox(u32 *q)
+	{
+	u32 x0, x1, x2, x3, x4, x5, x6, x7;
+	u32 y1, y2, y3, y4, y5, y6, y7, y8, y9;
+	u32 y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+	u32 y20, y21;
+	u32 z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+	u32 z10, z11, z12, z13, z14, z15, z16, z17;
+	u32 t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+	u32 t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+	u32 t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+	u32 t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+	u32 t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+	u32 t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+	u32 t60, t61, t62, t63, t64, t65, t66, t67;
+	u32 s0, s1, s2, s3, s4, s5, s6, s7;
+
+	x0 = q[7]; x1 = q[6]; x2 = q[5]; x3 = q[4];
+	x4 = q[3]; x5 = q[2]; x6 = q[1]; x7 = q[0];
+
+	/* top linear transformation */
+	y14 = x3 ^ x5;
+	y13 = x0 ^ x6;
+	y9  = x0 ^ x3;
+	y8  = x0 ^ x5;
+	t0  = x1 ^ x2;
+	y1  = t0 ^ x7;
+	y4  = y1 ^ x3;
+	y12 = y13 ^ y14;
+	y2  = y1 ^ x0;
+	y5  = y1 ^ x6;
+	y3  = y5 ^ y8;
+	t1  = x4 ^ y12;
+	y15 = t1 ^ x5;
+	y20 = t1 ^ x1;
+	y6  = y15 ^ x7;
+	y10 = y15 ^ t0;
+	y11 = y20 ^ y9;
+	y7  = x7 ^ y11;
+	y17 = y10 ^ y11;
+	y19 = y10 ^ y8;
+	y16 = t0 ^ y11;
+	y21 = y13 ^ y16;
+	y18 = x0 ^ y16;
+
+	/* non-linear section */
+	t2  = y12 & y15;
+	t3  = y3 & y6;
+	t4  = t3 ^ t2;
+	t5  = y4 & x7;
+	t6  = t5 ^ t2;
+	t7  = y13 & y16;
+	t8  = y5 & y1;
+	t9  = t8 ^ t7;
+	t10 = y2 & y7;
+	t11 = t10 ^ t7;
+	t12 = y9 & y11;
+	t13 = y14 & y17;
+	t14 = t13 ^ t12;
+	t15 = y8 & y10;
+	t16 = t15 ^ t12;
+	t17 = t4 ^ t14;
+	t18 = t6 ^ t16;
+	t19 = t9 ^ t14;
+	t20 = t11 ^ t16;
+	t21 = t17 ^ y20;
+	t22 = t18 ^ y19;
+	t23 = t19 ^ y21;
+	t24 = t20 ^ y18;
+
+	t25 = t21 ^ t22;
+	t26 = t21 & t23;
+	t27 = t24 ^ t26;
+	t28 = t25 & t27;
+	t29 = t28 ^ t22;
+	t30 = t23 ^ t24;
+	t31 = t22 ^ t26;
+	t32 = t31 & t30;
+	t33 = t32 ^ t24;
+	t34 = t23 ^ t33;
+	t35 = t27 ^ t33;
+	t36 = t24 & t35;
+	t37 = t36 ^ t34;
+	t38 = t27 ^ t36;
+	t39 = t29 & t38;
+	t40 = t25 ^ t39;
+
+	t41 = t40 ^ t37;
+	t42 = t29 ^ t33;
+	t43 = t29 ^ t40;
+	t44 = t33 ^ t37;
+	t45 = t42 ^ t41;
+	z0  = t44 & y15;
+	z1  = t37 & y6;
+	z2  = t33 & x7;
+	z3  = t43 & y16;
+	z4  = t40 & y1;
+	z5  = t29 & y7;
+	z6  = t42 & y11;
+	z7  = t45 & y17;
+	z8  = t41 & y10;
+	z9  = t44 & y12;
+	z10 = t37 & y3;
+	z11 = t33 & y4;
+	z12 = t43 & y13;
+	z13 = t40 & y5;
+	z14 = t29 & y2;
+	z15 = t42 & y9;
+	z16 = t45 & y14;
+	z17 = t41 & y8;
+
+	/* bottom linear transformation */
+	t46 = z15 ^ z16;
+	t47 = z10 ^ z11;
+	t48 = z5 ^ z13;
+	t49 = z9 ^ z10;
+	t50 = z2 ^ z12;
+	t51 = z2 ^ z5;
+	t52 = z7 ^ z8;
+	t53 = z0 ^ z3;
+	t54 = z6 ^ z7;
+	t55 = z16 ^ z17;
+	t56 = z12 ^ t48;
+	t57 = t50 ^ t53;
+	t58 = z4 ^ t46;
+	t59 = z3 ^ t54;
+	t60 = t46 ^ t57;
+	t61 = z14 ^ t57;
+	t62 = t52 ^ t58;
+	t63 = t49 ^ t58;
+	t64 = z4 ^ t59;
+	t65 = t61 ^ t62;
+	t66 = z1 ^ t63;
+	s0  = t59 ^ t63;
+	s6  = t56 ^ ~t62;
+	s7  = t48 ^ ~t60;
+	t67 = t64 ^ t65;
+	s3  = t53 ^ t66;
+	s4  = t51 ^ t66;
+	s5  = t47 ^ t65;
+	s1  = t64 ^ ~s3;
+	s2  = t55 ^ ~t67;
+
+	q[7] = s0; q[6] = s1; q[5] = s2; q[4] = s3;
+	q[3] = s4; q[2] = s5; q[1] = s6; q[0] = s7;
+	}
+
+/* inverse affine transform (constant 0x05 folded into the complements) */
+static void aes_ct_inv_affine(u32 *q)
+	{
+	u32 q0, q1, q2, q3, q4, q5, q6, q7;
+
+	q0 = ~q[0]; q1 = ~q[1]; q2 = q[2]; q3 = q[3];
+	q4 = q[4]; q5 = ~q[5]; q6 = ~q[6]; q7 = q[7];
+
+	q[7] = q1 ^ q4 ^ q6;
+	q[6] = q0 ^ q3 ^ q5;
+	q[5] = q7 ^ q2 ^ q4;
+	q[4] = q6 ^ q1 ^ q3;
+	q[3] = q5 ^ q0 ^ q2;
+	q[2] = q4 ^ q7 ^ q1;
+	q[1] = q3 ^ q6 ^ q0;
+	q[0] = q2 ^ q5 ^ q7;
+	}
+
+/* InvSubBytes(x) = A^-1(SubBytes(A^-1(x))) */
+static void aes_ct_inv_sbox(u32 *q)
+	{
+	aes_ct_inv_affine(q);
+	aes_ct_sbox(q);
+	aes_ct_inv_affine(q);
+	}
+
+#define SWAPN(cl, ch, s, x, y) { u32 a = (x), b = (y); \
+	(x) = (a & (u32)(cl)) | ((b & (u32)(cl)) << (s)); \
+	(y) = ((a & (u32)(ch)) >> (s)) | (b & (u32)(ch)); }
+
+#define SWAP2(x, y) SWAPN(0x55555555, 0xAAAAAAAA, 1, x, y)
+#define SWAP4(x, y) SWAPN(0x33333333, 0xCCCCCCCC, 2, x, y)
+#define SWAP8(x, y) SWAPN(0x0F0F0F0F, 0xF0F0F0F0, 4, x, y)
+
+/* converts between words and bit planes; it is its own inverse */
+static void aes_ct_ortho(u32 *q)
+	{
+	SWAP2(q[0], q[1]); SWAP2(q[2], q[3]); SWAP2(q[4], q[5]); SWAP2(q[6], q[7]);
+	SWAP4(q[0], q[2]); SWAP4(q[1], q[3]); SWAP4(q[4], q[6]); SWAP4(q[5], q[7]);
+	SWAP8(q[0], q[4]); SWAP8(q[1], q[5]); SWAP8(q[2], q[6]); SWAP8(q[3], q[7]);
+	}
+
+static u32 aes_ct_sub_word(u32 x)
+	{
+	u32 q[8];
+	int i;
+
+	for (i = 0; i < 8; i++) q[i] = 0;
+
+	q[0] = x;
+	aes_ct_ortho(q);
+	aes_ct_sbox(q);
+	aes_ct_ortho(q);
+
+	return q[0];
+	}
+
+static void aes_ct_add_round_key(u32 *q, const u32 *sk)
+	{
+	q[0] ^= sk[0]; q[1] ^= sk[1]; q[2] ^= sk[2]; q[3] ^= sk[3];
+	q[4] ^= sk[4]; q[5] ^= sk[5]; q[6] ^= sk[6]; q[7] ^= sk[7];
+	}
+
+static void aes_ct_shift_rows(u32 *q)
+	{
+	int i;
+
+	for (i = 0; i < 8; i++) {
+		u32 x = q[i];
+
+		q[i] = (x & 0x000000FF)
+			| ((x & 0x0000FC00) >> 2) | ((x & 0x00000300) << 6)
+			| ((x & 0x00F00000) >> 4) | ((x & 0x000F0000) << 4)
+			| ((x & 0xC0000000) >> 6) | ((x & 0x3F000000) << 2);
+	}
+	}
+
+static void aes_ct_inv_shift_rows(u32 *q)
+	{
+	int i;
+
+	for (i = 0; i < 8; i++) {
+		u32 x = q[i];
+
+		q[i] = (x & 0x000000FF)
+			| ((x & 0x00003F00) << 2) | ((x & 0x0000C000) >> 6)
+			| ((x & 0x000F0000) << 4) | ((x & 0x00F00000) >> 4)
+			| ((x & 0x03000000) << 6) | ((x & 0xFC000000) >> 2);
+	}
+	}
+
+#define ROTR8(x)  (((x) >> 8) | ((x) << 24))
+#define ROTR16(x) (((x) >> 16) | ((x) << 16))
+
+static void aes_ct_mix_columns(u32 *q)
+	{
+	u32 q0, q1, q2, q3, q4, q5, q6, q7;
+	u32 r0, r1, r2, r3, r4, r5, r6, r7;
+
+	q0 = q[0]; q1 = q[1]; q2 = q[2]; q3 = q[3];
+	q4 = q[4]; q5 = q[5]; q6 = q[6]; q7 = q[7];
+	r0 = ROTR8(q0); r1 = ROTR8(q1); r2 = ROTR8(q2); r3 = ROTR8(q3);
+	r4 = ROTR8(q4); r5 = ROTR8(q5); r6 = ROTR8(q6); r7 = ROTR8(q7);
+
+	q[0] = q7 ^ r7 ^ r0 ^ ROTR16(q0 ^ r0);
+	q[1] = q0 ^ r0 ^ q7 ^ r7 ^ r1 ^ ROTR16(q1 ^ r1);
+	q[2] = q1 ^ r1 ^ r2 ^ ROTR16(q2 ^ r2);
+	q[3] = q2 ^ r2 ^ q7 ^ r7 ^ r3 ^ ROTR16(q3 ^ r3);
+	q[4] = q3 ^ r3 ^ q7 ^ r7 ^ r4 ^ ROTR16(q4 ^ r4);
+	q[5] = q4 ^ r4 ^ r5 ^ ROTR16(q5 ^ r5);
+	q[6] = q5 ^ r5 ^ r6 ^ ROTR16(q6 ^ r6);
+	q[7] = q6 ^ r6 ^ r7 ^ ROTR16(q7 ^ r7);
+	}
+
+static void aes_ct_inv_mix_columns(u32 *q)
+	{
+	u32 q0, q1, q2, q3, q4, q5, q6, q7;
+	u32 r0, r1, r2, r3, r4, r5, r6, r7;
+
+	q0 = q[0]; q1 = q[1]; q2 = q[2]; q3 = q[3];
+	q4 = q[4]; q5 = q[5]; q6 = q[6]; q7 = q[7];
+	r0 = ROTR8(q0); r1 = ROTR8(q1); r2 = ROTR8(q2); r3 = ROTR8(q3);
+	r4 = ROTR8(q4); r5 = ROTR8(q5); r6 = ROTR8(q6); r7 = ROTR8(q7);
+
+	q[0] = q5 ^ q6 ^ q7 ^ r0 ^ r5 ^ r7 ^ ROTR16(q0 ^ q5 ^ q6 ^ r0 ^ r5);
+	q[1] = q0 ^ q5 ^ r0 ^ r1 ^ r5 ^ r6 ^ r7 ^ ROTR16(q1 ^ q5 ^ q7 ^ r1 ^ r5 ^ r6);
+	q[2] = q0 ^ q1 ^ q6 ^ r1 ^ r2 ^ r6 ^ r7 ^ ROTR16(q0 ^ q2 ^ q6 ^ r2 ^ r6 ^ r7);
+	q[3] = q0 ^ q1 ^ q2 ^ q5 ^ q6 ^ r0 ^ r2 ^ r3 ^ r5 ^ ROTR16(q0 ^ q1 ^ q3 ^ q5 ^ q6 ^ q7 ^ r0 ^ r3 ^ r5 ^ r7);
+	q[4] = q1 ^ q2 ^ q3 ^ q5 ^ r1 ^ r3 ^ r4 ^ r5 ^ r6 ^ r7 ^ ROTR16(q1 ^ q2 ^ q4 ^ q5 ^ q7 ^ r1 ^ r4 ^ r5 ^ r6);
+	q[5] = q2 ^ q3 ^ q4 ^ q6 ^ r2 ^ r4 ^ r5 ^ r6 ^ r7 ^ ROTR16(q2 ^ q3 ^ q5 ^ q6 ^ r2 ^ r5 ^ r6 ^ r7);
+	q[6] = q3 ^ q4 ^ q5 ^ q7 ^ r3 ^ r5 ^ r6 ^ r7 ^ ROTR16(q3 ^ q4 ^ q6 ^ q7 ^ r3 ^ r6 ^ r7);
+	q[7] = q4 ^ q5 ^ q6 ^ r4 ^ r6 ^ r7 ^ ROTR16(q4 ^ q5 ^ q7 ^ r4 ^ r7);
+	}
+
+/* expands the compressed schedule to one 8 word round key per round */
+static void aes_ct_expand_key(u32 *skey, const AES_KEY *key)
+	{
+	int i, n = (key->rounds + 1) << 2;
+
+	for (i = 0; i < n; i++) {
+		u32 x, y;
+
+		x = y = key->rd_key[i];
+		x &= 0x55555555;
+		y &= 0xAAAAAAAA;
+		skey[(i << 1) + 0] = x | (x << 1);
+		skey[(i << 1) + 1] = y | (y >> 1);
+	}
+	}
+
+static const u8 rcon[] = {
+	0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1B, 0x36
+};
+
+int AES_set_encrypt_key(const unsigned char *userKey, const int bits,
+			AES_KEY *key)
+	{
+	u32 skey[8 * (AES_MAXNR + 1)];
+	u32 tmp;
+	int i, j, k, nk, nkf;
+
+	if (!userKey || !key)
+		return -1;
+	if (bits != 128 && bits != 192 && bits != 256)
+		return -2;
+
+	nk = bits >> 5;
+	key->rounds = nk + 6;
+	nkf = (key->rounds + 1) << 2;
+
+	tmp = 0;
+	for (i = 0; i < nk; i++) {
+		tmp = GETU32LE(userKey + (i << 2));
+		skey[(i << 1) + 0] = tmp;
+		skey[(i << 1) + 1] = tmp;
+	}
+	for (i = nk, j = 0, k = 0; i < nkf; i++) {
+		if (j == 0) {
+			tmp = (tmp << 24) | (tmp >> 8);
+			tmp = aes_ct_sub_word(tmp) ^ rcon[k];
+		} else if (nk > 6 && j == 4) {
+			tmp = aes_ct_sub_word(tmp);
+		}
+		tmp ^= skey[(i - nk) << 1];
+		skey[(i << 1) + 0] = tmp;
+		skey[(i << 1) + 1] = tmp;
+		if (++j == nk) {
+			j = 0;
+			k++;
+		}
+	}
+
+	for (i = 0; i < nkf; i += 4) {
+		aes_ct_ortho(skey + (i << 1));
+	}
+	for (i = 0, j = 0; i < nkf; i++, j += 2) {
+		key->rd_key[i] = (skey[j + 0] & 0x55555555) | (skey[j + 1] & 0xAAAAAAAA);
+	}
+
+	OPENSSL_cleanse(skey, sizeof(skey));
+
+	return 0;
+	}
+
+int AES_set_decrypt_key(const unsigned char *userKey, const int bits,
+			AES_KEY *key)
+	{
+	return AES_set_encrypt_key(userKey, bits, key);
+	}
+
+/*
+ * Only the first of the two block slots carries data here; the EVP and mode
+ * code hand AES one block at a time.
+ */
+void AES_encrypt(const unsigned char *in, unsigned char *out,
+		 const AES_KEY *key)
+	{
+	u32 skey[8 * (AES_MAXNR + 1)];
+	u32 q[8];
+	int u;
+
+	TINYCLR_SSL_ASSERT(in && out && key);
+
+	aes_ct_expand_key(skey, key);
+
+	q[0] = GETU32LE(in     ); q[1] = 0;
+	q[2] = GETU32LE(in +  4); q[3] = 0;
+	q[4] = GETU32LE(in +  8); q[5] = 0;
+	q[6] = GETU32LE(in + 12); q[7] = 0;
+
+	aes_ct_ortho(q);
+
+	aes_ct_add_round_key(q, skey);
+	for (u = 1; u < key->rounds; u++) {
+		aes_ct_sbox(q);
+		aes_ct_shift_rows(q);
+		aes_ct_mix_columns(q);
+		aes_ct_add_round_key(q, skey + (u << 3));
+	}
+	aes_ct_sbox(q);
+	aes_ct_shift_rows(q);
+	aes_ct_add_round_key(q, skey + (key->rounds << 3));
+
+	aes_ct_ortho(q);
+
+	PUTU32LE(out     , q[0]);
+	PUTU32LE(out +  4, q[2]);
+	PUTU32LE(out +  8, q[4]);
+	PUTU32LE(out + 12, q[6]);
+	}
+
+void AES_decrypt(const unsigned char *in, unsigned char *out,
+		 const AES_KEY *key)
+	{
+	u32 skey[8 * (AES_MAXNR + 1)];
+	u32 q[8];
+	int u;
+
+	TINYCLR_SSL_ASSERT(in && out && key);
+
+	aes_ct_expand_key(skey, key);
+
+	q[0] = GETU32LE(in     ); q[1] = 0;
+	q[2] = GETU32LE(in +  4); q[3] = 0;
+	q[4] = GETU32LE(in +  8); q[5] = 0;
+	q[6] = GETU32LE(in + 12); q[7] = 0;
+
+	aes_ct_ortho(q);
+
+	aes_ct_add_round_key(q, skey + (key->rounds << 3));
+	for (u = key->rounds - 1; u > 0; u--) {
+		aes_ct_inv_shift_rows(q);
+		aes_ct_inv_sbox(q);
+		aes_ct_add_round_key(q, skey + (u << 3));
+		aes_ct_inv_mix_columns(q);
+	}
+	aes_ct_inv_shift_rows(q);
+	aes_ct_inv_sbox(q);
+	aes_ct_add_round_key(q, skey);
+
+	aes_ct_ortho(q);
+
+	PUTU32LE(out     , q[0]);
+	PUTU32LE(out +  4, q[2]);
+	PUTU32LE(out +  8, q[4]);
+	PUTU32LE(out + 12, q[6]);
+	}
+
+#endif /* TINYCLR_SSL_AES_CONSTANT_TIME */
@@ -89,6 +89,10 @@ typedef unsigned char u8;
 #define MAXNR   14
 
 /* This controls loop-unrolling in aes_core.c */
+#ifdef TINYCLR_SSL_AES_FULL_UNROLL
+#define FULL_UNROLL
+#else
 #undef FULL_UNROLL
+#endif
 
 #endif /* !HEADER_AES_LOCL_H */
@@ -56,7 +56,9 @@
 const char AES_version[]="AES" OPENSSL_VERSION_PTEXT;
 
 const char *AES_options(void) {
-#ifdef FULL_UNROLL
+#if defined(TINYCLR_SSL_AES_CONSTANT_TIME)
+        return "aes(ct)";
+#elif defined(FULL_UNROLL)
         return "aes(full)";
 #else   
         return "aes(partial)";
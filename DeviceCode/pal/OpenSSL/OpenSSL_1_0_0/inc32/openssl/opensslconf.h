@@ -44,6 +44,13 @@
 #endif
 //MS:end
 
+//MS: cipher and digest implementations, selected by defining these for the platform build:
+//  TINYCLR_SSL_AES_FULL_UNROLL     AES rounds fully unrolled (aes_core.c); faster, larger code
+//  TINYCLR_SSL_AES_CONSTANT_TIME   bitsliced AES without table lookups (aes_ct.c); slower, no cache timing leak
+//  TINYCLR_SSL_RC4_CHUNK           RC4 on word aligned buffers a word at a time
+//  OPENSSL_SMALL_FOOTPRINT         rolled SHA-1/SHA-256 loops; leave undefined for the unrolled ones
+//MS:end
+
 #ifndef OPENSSL_DOING_MAKEDEPEND
 
 #ifndef OPENSSL_NO_CAMELLIA
@@ -177,9 +184,13 @@
  * This enables code handling data aligned at natural CPU word
  * boundary. See crypto/rc4/rc4_enc.c for further details.
  */
+#ifdef TINYCLR_SSL_RC4_CHUNK
+#define RC4_CHUNK unsigned long
+#else
 #undef RC4_CHUNK
 #endif
 #endif
+#endif
 
 #if (defined(HEADER_NEW_DES_H) || defined(HEADER_DES_H)) && !defined(DES_LONG)
 /* If this is set to 'unsigned int' on a DEC Alpha, this gives about a
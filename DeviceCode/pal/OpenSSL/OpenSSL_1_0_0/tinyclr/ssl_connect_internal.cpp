@@ -24,11 +24,22 @@ int ssl_connect_internal(int sd, const char* szTargetHost, int sslContextHandle)
         goto error;
     }
 
+    // SSL_Connect is called repeatedly until the handshake completes; offer a cached
+    // session for this host only before the first ClientHello goes out
+    if (SOCKET_DRIVER.GetSocketSslData(sd) == NULL)
+    {
+        ssl_session_cache_apply_client(ssl, sd, szTargetHost);
+    }
+
     err = SSL_connect (ssl);    
 
     err = SSL_get_error(ssl,err);
       
-    if(err == SSL_ERROR_WANT_READ)
+    if(err == SSL_ERROR_NONE)
+    {
+        ssl_session_cache_store_client(ssl, sd, szTargetHost);
+    }
+    else if(err == SSL_ERROR_WANT_READ)
     {
         err = SOCK_EWOULDBLOCK;
 #ifndef TCPIP_LWIP
@@ -42,6 +53,11 @@ int ssl_connect_internal(int sd, const char* szTargetHost, int sslContextHandle)
         SOCKET_DRIVER.ClearStatusBitsForSocket( sd, TRUE );        
 #endif
     }
+    else if(err == SSL_ERROR_SSL)
+    {
+        // the handshake itself failed; do not offer a session the server just refused again
+        ssl_session_cache_remove_client(ssl, sd, szTargetHost);
+    }
 
     SOCKET_DRIVER.SetSocketSslData(sd, (void*)ssl);
 
@@ -32,6 +32,8 @@ int ssl_read_internal( int socket, char* Data, size_t size );
 int ssl_write_internal( int socket, const char* Data, size_t size);
 int ssl_closesocket_internal( int sd );
 int ssl_pending_internal( int sd );
+int ssl_session_reused_internal( int sd );
+BOOL ssl_set_option_internal( int sslContextHandle, int option, int value );
 BOOL ssl_exit_context_internal(int sslContextHandle );
 BOOL ssl_generic_init_internal( int sslMode, int sslVerify, const char* certificate, int cert_len, int& sslContextHandle, BOOL isServer );
 BOOL ssl_initialize_internal();
@@ -39,4 +41,15 @@ BOOL ssl_uninitialize_internal();
 void ssl_clear_cert_auth_internal(int sslContextHandle );
 BOOL ssl_add_cert_auth_internal( int sslContextHandle, const char* certificate, 	int cert_len, const char* szCertPwd );
 
+// session resumption caches, see ssl_session_cache_internal.cpp
+struct ssl_st;
+struct ssl_ctx_st;
+
+void ssl_session_cache_apply_client( struct ssl_st* ssl, int sd, const char* szTargetHost );
+void ssl_session_cache_store_client( struct ssl_st* ssl, int sd, const char* szTargetHost );
+void ssl_session_cache_remove_client( struct ssl_st* ssl, int sd, const char* szTargetHost );
+void ssl_session_cache_init_server( struct ssl_ctx_st* ctx, int sslVerify, const char* certificate, int cert_len );
+BOOL ssl_session_cache_set_size( BOOL isServer, int sessions );
+void ssl_session_cache_clear();
+
 #endif
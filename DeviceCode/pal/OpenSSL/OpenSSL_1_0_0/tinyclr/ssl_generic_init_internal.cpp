@@ -93,6 +93,8 @@ BOOL ssl_generic_init_internal( int sslMode, int sslVerify, const char* certific
             goto err;
         }
 
+        ssl_session_cache_init_server(ctx, sslVerify, certificate, cert_len);
+
         // create the SSL object
         ssl = SSL_new(ctx);
         if (ssl == NULL)
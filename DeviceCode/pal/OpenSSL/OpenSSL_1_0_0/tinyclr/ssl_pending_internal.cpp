@@ -2,6 +2,33 @@
 #include <openssl/ssl.h>
 #include <openssl.h>
 
+// Read-ahead can leave complete records undecrypted in the read buffer while the socket itself
+// is empty, and SSL_pending only counts decrypted data. OpenSSL 1.0.0 has no API for the raw
+// buffer, so this reads ssl->rstate and s3->rbuf directly; check it again when OpenSSL is updated.
+#if OPENSSL_VERSION_NUMBER != 0x1000000fL
+#error ssl_record_buffered reads OpenSSL 1.0.0 internals
+#endif
+
+static BOOL ssl_record_buffered( SSL* ssl )
+{
+    SSL3_BUFFER* rbuf;
+
+    if(ssl->s3 == NULL || ssl->rstate != SSL_ST_READ_HEADER) return FALSE;
+
+    rbuf = &ssl->s3->rbuf;
+
+    // a partial record needs more socket data before it can be read
+    if(rbuf->left >= SSL3_RT_HEADER_LENGTH)
+    {
+        const unsigned char* header = rbuf->buf + rbuf->offset;
+        int                  length = (header[3] << 8) | header[4];
+
+        return rbuf->left >= SSL3_RT_HEADER_LENGTH + length;
+    }
+
+    return FALSE;
+}
+
 int ssl_pending_internal( int sd )
 {
     int avail = 0;
@@ -14,6 +41,11 @@ int ssl_pending_internal( int sd )
     
     avail = SSL_pending(ssl);  /* send SSL/TLS close_notify */
 
+    if(avail == 0 && SSL_get_read_ahead(ssl) && ssl_record_buffered(ssl))
+    {
+        avail = 1;
+    }
+
     return avail;
 }
 
@@ -0,0 +1,378 @@
+#include <e_os.h>
+#include <tinyclr/ssl_functions.h>
+#include <openssl/ssl.h>
+#include <openssl/sha.h>
+#include <openssl.h>
+
+// Sessions outlive the SSL contexts (one per SslStream), so both caches are global and bounded.
+// Client sessions are keyed by target host, peer port and a digest of the context's verify mode,
+// client certificate and trusted CAs, so a session is only offered again under the same trust
+// settings it was negotiated with; server sessions are keyed by session ID. When a cache is full
+// the least recently used entry is dropped. The sizes are set through SSL_SetOption, a size of 0
+// turns resumption off for that side; the tables are allocated when the first session is stored.
+
+static const int c_DefaultClientSessions = 4;
+static const int c_DefaultServerSessions = 8;
+static const int c_MaxSessions           = 64;
+static const int c_MaxHostLength         = 64;
+
+struct SSL_ClientSessionKey
+{
+    const char*   Host;
+    UINT16        Port;
+    unsigned char Context[SHA_DIGEST_LENGTH];
+};
+
+struct SSL_ClientSessionEntry
+{
+    SSL_SESSION*  Session;
+    UINT32        LastUsed;
+    UINT16        Port;
+    unsigned char Context[SHA_DIGEST_LENGTH];
+    char          Host[c_MaxHostLength];
+};
+
+struct SSL_ServerSessionEntry
+{
+    SSL_SESSION*  Session;
+    UINT32        LastUsed;
+};
+
+static SSL_ClientSessionEntry* s_clientSessions;
+static SSL_ServerSessionEntry* s_serverSessions;
+static int                     s_maxClientSessions = c_DefaultClientSessions;
+static int                     s_maxServerSessions = c_DefaultServerSessions;
+static UINT32                  s_useCount;
+
+//--//
+
+static void* ssl_session_table_alloc( int count, size_t entrySize )
+{
+    void* table = OPENSSL_malloc(count * entrySize);
+
+    if(table != NULL)
+    {
+        TINYCLR_SSL_MEMSET(table, 0, count * entrySize);
+    }
+
+    return table;
+}
+
+static void ssl_session_cache_free_client()
+{
+    if(s_clientSessions == NULL) return;
+
+    for(int i=0; i<s_maxClientSessions; i++)
+    {
+        if(s_clientSessions[i].Session != NULL)
+        {
+            SSL_SESSION_free(s_clientSessions[i].Session);
+        }
+    }
+
+    OPENSSL_free(s_clientSessions);
+
+    s_clientSessions = NULL;
+}
+
+static void ssl_session_cache_free_server()
+{
+    if(s_serverSessions == NULL) return;
+
+    for(int i=0; i<s_maxServerSessions; i++)
+    {
+        if(s_serverSessions[i].Session != NULL)
+        {
+            SSL_SESSION_free(s_serverSessions[i].Session);
+        }
+    }
+
+    OPENSSL_free(s_serverSessions);
+
+    s_serverSessions = NULL;
+}
+
+//--//
+
+static void ssl_session_digest_cert( SHA_CTX* sha, X509* cert )
+{
+    unsigned char md[SHA_DIGEST_LENGTH];
+    unsigned int  mdLength = sizeof(md);
+
+    if(cert != NULL && X509_digest(cert, EVP_sha1(), md, &mdLength))
+    {
+        SHA1_Update(sha, md, mdLength);
+    }
+}
+
+static BOOL ssl_client_session_key( SSL* ssl, int sd, const char* szTargetHost, SSL_ClientSessionKey& key )
+{
+    SOCK_sockaddr_in peer;
+    int              peerLength = sizeof(peer);
+    int              verifyMode;
+    X509_STORE*      store;
+    SHA_CTX          sha;
+
+    if(szTargetHost == NULL || szTargetHost[0] == 0 || TINYCLR_SSL_STRLEN(szTargetHost) >= c_MaxHostLength) return FALSE;
+
+    if(SOCK_getpeername(sd, (SOCK_sockaddr*)&peer, &peerLength) != 0) return FALSE;
+
+    key.Host = szTargetHost;
+    key.Port = peer.sin_port;
+
+    verifyMode = SSL_get_verify_mode(ssl);
+    store      = SSL_CTX_get_cert_store(SSL_get_SSL_CTX(ssl));
+
+    SHA1_Init(&sha);
+
+    SHA1_Update(&sha, &verifyMode, sizeof(verifyMode));
+
+    ssl_session_digest_cert(&sha, SSL_get_certificate(ssl));
+
+    if(store != NULL && store->objs != NULL)
+    {
+        for(int i=0; i<sk_X509_OBJECT_num(store->objs); i++)
+        {
+            X509_OBJECT* obj = sk_X509_OBJECT_value(store->objs, i);
+
+            if(obj->type == X509_LU_X509)
+            {
+                ssl_session_digest_cert(&sha, obj->data.x509);
+            }
+        }
+    }
+
+    SHA1_Final(key.Context, &sha);
+
+    return TRUE;
+}
+
+static SSL_ClientSessionEntry* ssl_find_client_session( const SSL_ClientSessionKey& key )
+{
+    if(s_clientSessions == NULL) return NULL;
+
+    for(int i=0; i<s_maxClientSessions; i++)
+    {
+        SSL_ClientSessionEntry* entry = &s_clientSessions[i];
+
+        if(entry->Session != NULL && entry->Port == key.Port && 0 == TINYCLR_SSL_MEMCMP(entry->Context, key.Context, SHA_DIGEST_LENGTH) && 0 == TINYCLR_SSL_STRCASECMP(entry->Host, key.Host))
+        {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+void ssl_session_cache_apply_client( SSL* ssl, int sd, const char* szTargetHost )
+{
+    SSL_ClientSessionKey    key;
+    SSL_ClientSessionEntry* entry;
+
+    if(!ssl_client_session_key( ssl, sd, szTargetHost, key )) return;
+
+    entry = ssl_find_client_session( key );
+
+    if(entry != NULL)
+    {
+        entry->LastUsed = ++s_useCount;
+
+        SSL_set_session(ssl, entry->Session);
+    }
+}
+
+void ssl_session_cache_store_client( SSL* ssl, int sd, const char* szTargetHost )
+{
+    SSL_ClientSessionKey    key;
+    SSL_ClientSessionEntry* entry;
+    SSL_SESSION*            session;
+
+    if(s_clientSessions == NULL && s_maxClientSessions > 0)
+    {
+        s_clientSessions = (SSL_ClientSessionEntry*)ssl_session_table_alloc( s_maxClientSessions, sizeof(SSL_ClientSessionEntry) );
+    }
+
+    if(s_clientSessions == NULL) return;
+
+    if(!ssl_client_session_key( ssl, sd, szTargetHost, key )) return;
+
+    session = SSL_get1_session(ssl);
+
+    if(session == NULL) return;
+
+    entry = ssl_find_client_session( key );
+
+    if(entry == NULL)
+    {
+        entry = &s_clientSessions[0];
+
+        for(int i=1; i<s_maxClientSessions; i++)
+        {
+            if(entry->Session == NULL) break;
+
+            if(s_clientSessions[i].Session == NULL || s_clientSessions[i].LastUsed < entry->LastUsed)
+            {
+                entry = &s_clientSessions[i];
+            }
+        }
+
+        TINYCLR_SSL_STRNCPY(entry->Host, key.Host, c_MaxHostLength - 1);
+        TINYCLR_SSL_MEMCPY(entry->Context, key.Context, SHA_DIGEST_LENGTH);
+
+        entry->Port = key.Port;
+    }
+
+    if(entry->Session != NULL)
+    {
+        SSL_SESSION_free(entry->Session);
+    }
+
+    entry->Session  = session;
+    entry->LastUsed = ++s_useCount;
+}
+
+void ssl_session_cache_remove_client( SSL* ssl, int sd, const char* szTargetHost )
+{
+    SSL_ClientSessionKey    key;
+    SSL_ClientSessionEntry* entry;
+
+    if(!ssl_client_session_key( ssl, sd, szTargetHost, key )) return;
+
+    entry = ssl_find_client_session( key );
+
+    if(entry != NULL)
+    {
+        SSL_SESSION_free(entry->Session);
+
+        TINYCLR_SSL_MEMSET(entry, 0, sizeof(*entry));
+    }
+}
+
+//--//
+
+static int ssl_server_session_new( SSL* ssl, SSL_SESSION* session )
+{
+    SSL_ServerSessionEntry* entry;
+
+    if(s_serverSessions == NULL && s_maxServerSessions > 0)
+    {
+        s_serverSessions = (SSL_ServerSessionEntry*)ssl_session_table_alloc( s_maxServerSessions, sizeof(SSL_ServerSessionEntry) );
+    }
+
+    // returning 0 leaves the reference with OpenSSL
+    if(s_serverSessions == NULL) return 0;
+
+    entry = &s_serverSessions[0];
+
+    for(int i=1; i<s_maxServerSessions; i++)
+    {
+        if(entry->Session == NULL) break;
+
+        if(s_serverSessions[i].Session == NULL || s_serverSessions[i].LastUsed < entry->LastUsed)
+        {
+            entry = &s_serverSessions[i];
+        }
+    }
+
+    if(entry->Session != NULL)
+    {
+        SSL_SESSION_free(entry->Session);
+    }
+
+    entry->Session  = session;
+    entry->LastUsed = ++s_useCount;
+
+    // we keep the reference OpenSSL handed us
+    return 1;
+}
+
+static SSL_SESSION* ssl_server_session_get( SSL* ssl, unsigned char* id, int idLength, int* copy )
+{
+    *copy = 1;
+
+    if(s_serverSessions == NULL) return NULL;
+
+    for(int i=0; i<s_maxServerSessions; i++)
+    {
+        SSL_SESSION* session = s_serverSessions[i].Session;
+
+        if(session != NULL && (int)session->session_id_length == idLength && 0 == TINYCLR_SSL_MEMCMP(session->session_id, id, idLength))
+        {
+            s_serverSessions[i].LastUsed = ++s_useCount;
+
+            return session;
+        }
+    }
+
+    return NULL;
+}
+
+static void ssl_server_session_remove( SSL_CTX* ctx, SSL_SESSION* session )
+{
+    if(s_serverSessions == NULL) return;
+
+    for(int i=0; i<s_maxServerSessions; i++)
+    {
+        if(s_serverSessions[i].Session == session)
+        {
+            s_serverSessions[i].Session = NULL;
+
+            SSL_SESSION_free(session);
+            break;
+        }
+    }
+}
+
+void ssl_session_cache_init_server( SSL_CTX* ctx, int sslVerify, const char* certificate, int cert_len )
+{
+    unsigned char sidContext[SHA_DIGEST_LENGTH];
+    SHA_CTX       sha;
+
+    // sessions may only be resumed by a context serving the same certificate with the same client
+    // authentication, so a session negotiated without a client certificate never satisfies a
+    // context that requires one
+    SHA1_Init(&sha);
+    SHA1_Update(&sha, certificate, cert_len);
+    SHA1_Update(&sha, &sslVerify, sizeof(sslVerify));
+    SHA1_Final(sidContext, &sha);
+
+    SSL_CTX_set_session_id_context(ctx, sidContext, sizeof(sidContext));
+
+    SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_SERVER | SSL_SESS_CACHE_NO_INTERNAL);
+
+    SSL_CTX_sess_set_new_cb   (ctx, ssl_server_session_new   );
+    SSL_CTX_sess_set_get_cb   (ctx, ssl_server_session_get   );
+    SSL_CTX_sess_set_remove_cb(ctx, ssl_server_session_remove);
+}
+
+//--//
+
+BOOL ssl_session_cache_set_size( BOOL isServer, int sessions )
+{
+    if(sessions < 0 || sessions > c_MaxSessions) return FALSE;
+
+    // cached sessions are dropped, connections holding one keep their own reference
+    if(isServer)
+    {
+        ssl_session_cache_free_server();
+
+        s_maxServerSessions = sessions;
+    }
+    else
+    {
+        ssl_session_cache_free_client();
+
+        s_maxClientSessions = sessions;
+    }
+
+    return TRUE;
+}
+
+void ssl_session_cache_clear()
+{
+    ssl_session_cache_free_client();
+    ssl_session_cache_free_server();
+
+    s_useCount = 0;
+}
+
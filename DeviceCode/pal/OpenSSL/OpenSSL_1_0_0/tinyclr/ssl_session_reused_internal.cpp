@@ -0,0 +1,16 @@
+#include <tinyclr/ssl_functions.h>
+#include <openssl/ssl.h>
+#include <openssl.h>
+
+int ssl_session_reused_internal( int sd )
+{
+    SSL *ssl = (SSL*)SOCKET_DRIVER.GetSocketSslData(sd);
+
+    if(ssl == NULL || ssl == (void*)SSL_SOCKET_ATTEMPTED_CONNECT)
+    {
+        return SOCK_SOCKET_ERROR;
+    }
+
+    return SSL_session_reused(ssl) ? 1 : 0;
+}
+
@@ -0,0 +1,32 @@
+#include <tinyclr/ssl_functions.h>
+#include <openssl/ssl.h>
+#include <openssl.h>
+
+BOOL ssl_set_option_internal( int sslContextHandle, int option, int value )
+{
+    SSL* ssl;
+
+    switch(option)
+    {
+        case SSL_OPTION__READ_AHEAD:
+            if((sslContextHandle >= ARRAYSIZE(g_SSL_Driver.m_sslContextArray)) || (sslContextHandle < 0)) return FALSE;
+
+            ssl = (SSL*)g_SSL_Driver.m_sslContextArray[sslContextHandle].SslContext;
+
+            if(ssl == NULL) return FALSE;
+
+            // read everything the socket has into the record buffer rather than one record
+            // header and body at a time
+            SSL_set_read_ahead(ssl, value != 0);
+            return TRUE;
+
+        case SSL_OPTION__CLIENT_SESSION_CACHE:
+            return ssl_session_cache_set_size( FALSE, value );
+
+        case SSL_OPTION__SERVER_SESSION_CACHE:
+            return ssl_session_cache_set_size( TRUE, value );
+    }
+
+    return FALSE;
+}
+
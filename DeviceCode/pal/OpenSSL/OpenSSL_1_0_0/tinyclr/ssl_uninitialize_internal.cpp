@@ -16,6 +16,8 @@ BOOL ssl_uninitialize_internal()
       
     g_SSL_Driver.m_sslContextCount = 0;
 
+    ssl_session_cache_clear();
+
     return result;
 }
 
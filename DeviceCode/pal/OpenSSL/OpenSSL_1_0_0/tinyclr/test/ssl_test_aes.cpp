@@ -0,0 +1,136 @@
+/*
+ * AES known answer tests: the FIPS-197 appendix C single block vectors for
+ * each key size, and the SP 800-38A F.2.1/F.2.2 CBC vectors through EVP.
+ * Run against whichever AES implementation the build selected.
+ */
+#include "ssl_tests.h"
+#include <openssl/aes.h>
+#include <openssl/evp.h>
+#include <tinyclr/ssl_types.h>
+#ifdef OPENSSL_SYS_WINDOWS
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#endif
+
+#ifdef OPENSSL_NO_AES
+int ssl_test_aes(int argc, char *argv[])
+{
+    TINYCLR_SSL_PRINTF("No AES support\n");
+    return(0);
+}
+#else
+
+static unsigned char fips_key[32] = {
+	0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,
+	0x08,0x09,0x0a,0x0b,0x0c,0x0d,0x0e,0x0f,
+	0x10,0x11,0x12,0x13,0x14,0x15,0x16,0x17,
+	0x18,0x19,0x1a,0x1b,0x1c,0x1d,0x1e,0x1f };
+
+static unsigned char fips_plain[AES_BLOCK_SIZE] = {
+	0x00,0x11,0x22,0x33,0x44,0x55,0x66,0x77,
+	0x88,0x99,0xaa,0xbb,0xcc,0xdd,0xee,0xff };
+
+static unsigned char fips_cipher[3][AES_BLOCK_SIZE] = {
+	{ 0x69,0xc4,0xe0,0xd8,0x6a,0x7b,0x04,0x30,
+	  0xd8,0xcd,0xb7,0x80,0x70,0xb4,0xc5,0x5a },
+	{ 0xdd,0xa9,0x7c,0xa4,0x86,0x4c,0xdf,0xe0,
+	  0x6e,0xaf,0x70,0xa0,0xec,0x0d,0x71,0x91 },
+	{ 0x8e,0xa2,0xb7,0xca,0x51,0x67,0x45,0xbf,
+	  0xea,0xfc,0x49,0x90,0x4b,0x49,0x60,0x89 } };
+
+static unsigned char cbc_key[16] = {
+	0x2b,0x7e,0x15,0x16,0x28,0xae,0xd2,0xa6,
+	0xab,0xf7,0x15,0x88,0x09,0xcf,0x4f,0x3c };
+
+static unsigned char cbc_iv[16] = {
+	0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,
+	0x08,0x09,0x0a,0x0b,0x0c,0x0d,0x0e,0x0f };
+
+static unsigned char cbc_plain[64] = {
+	0x6b,0xc1,0xbe,0xe2,0x2e,0x40,0x9f,0x96,
+	0xe9,0x3d,0x7e,0x11,0x73,0x93,0x17,0x2a,
+	0xae,0x2d,0x8a,0x57,0x1e,0x03,0xac,0x9c,
+	0x9e,0xb7,0x6f,0xac,0x45,0xaf,0x8e,0x51,
+	0x30,0xc8,0x1c,0x46,0xa3,0x5c,0xe4,0x11,
+	0xe5,0xfb,0xc1,0x19,0x1a,0x0a,0x52,0xef,
+	0xf6,0x9f,0x24,0x45,0xdf,0x4f,0x9b,0x17,
+	0xad,0x2b,0x41,0x7b,0xe6,0x6c,0x37,0x10 };
+
+static unsigned char cbc_cipher[64] = {
+	0x76,0x49,0xab,0xac,0x81,0x19,0xb2,0x46,
+	0xce,0xe9,0x8e,0x9b,0x12,0xe9,0x19,0x7d,
+	0x50,0x86,0xcb,0x9b,0x50,0x72,0x19,0xee,
+	0x95,0xdb,0x11,0x3a,0x91,0x76,0x78,0xb2,
+	0x73,0xbe,0xd6,0xb8,0xe3,0xc1,0x74,0x3b,
+	0x71,0x16,0xe6,0x9e,0x22,0x22,0x95,0x16,
+	0x3f,0xf1,0xca,0xa1,0x68,0x1f,0xac,0x09,
+	0x12,0x0e,0xca,0x30,0x75,0x86,0xe1,0xa7 };
+
+static int ssl_test_aes_cbc(int enc, const unsigned char *in, const unsigned char *expected)
+{
+  unsigned char   out[sizeof(cbc_plain)];
+  int             len, tail;
+  EVP_CIPHER_CTX  ctx;
+
+    EVP_CIPHER_CTX_init (&ctx);
+    EVP_CipherInit_ex (&ctx,EVP_aes_128_cbc(),NULL,cbc_key,cbc_iv,enc);
+    EVP_CIPHER_CTX_set_padding (&ctx,0);
+
+    /* feed it unevenly so the partial block handling is exercised too */
+    EVP_CipherUpdate (&ctx,out,&len,in,23);
+    EVP_CipherUpdate (&ctx,out+len,&tail,in+23,sizeof(cbc_plain)-23);
+    len += tail;
+    EVP_CipherFinal_ex (&ctx,out+len,&tail);
+    len += tail;
+    EVP_CIPHER_CTX_cleanup (&ctx);
+
+    return len == sizeof(cbc_plain) && TINYCLR_SSL_MEMCMP(out,expected,len) == 0;
+}
+
+int ssl_test_aes(int argc, char *argv[])
+{
+  unsigned char out[AES_BLOCK_SIZE];
+  AES_KEY       key;
+  int           i;
+
+    TINYCLR_SSL_PRINTF("Testing %s ", AES_options());
+
+    for (i=0;i<3;i++)
+    {
+	AES_set_encrypt_key (fips_key,128+64*i,&key);
+	AES_encrypt (fips_plain,out,&key);
+	if (TINYCLR_SSL_MEMCMP(out,fips_cipher[i],AES_BLOCK_SIZE))
+	{   TINYCLR_SSL_PRINTF("\nAES-%d encrypt failed.\n",128+64*i);
+	    return 1;
+	}
+
+	AES_set_decrypt_key (fips_key,128+64*i,&key);
+	AES_decrypt (fips_cipher[i],out,&key);
+	if (TINYCLR_SSL_MEMCMP(out,fips_plain,AES_BLOCK_SIZE))
+	{   TINYCLR_SSL_PRINTF("\nAES-%d decrypt failed.\n",128+64*i);
+	    return 1;
+	}
+
+	TINYCLR_SSL_PRINTF(".");
+    }
+
+    if (!ssl_test_aes_cbc(1,cbc_plain,cbc_cipher))
+    {	TINYCLR_SSL_PRINTF("\nAES-128-CBC encrypt failed.\n");
+	return 1;
+    }
+    else
+	TINYCLR_SSL_PRINTF(".");
+
+    if (!ssl_test_aes_cbc(0,cbc_cipher,cbc_plain))
+    {	TINYCLR_SSL_PRINTF("\nAES-128-CBC decrypt failed.\n");
+	return 1;
+    }
+    else
+	TINYCLR_SSL_PRINTF(".");
+
+    TINYCLR_SSL_PRINTF(" passed.\n");
+
+    return 0;
+}
+#endif
@@ -0,0 +1,118 @@
+/*
+ * Bulk cipher and digest throughput in core clock cycles per byte, for
+ * comparing the implementations selectable in openssl/opensslconf.h.  On the
+ * desktop build the cycles come from the time stamp counter; on a device they
+ * are the HAL tick count scaled by the system clock.
+ */
+#include "ssl_tests.h"
+#include <openssl/aes.h>
+#include <openssl/evp.h>
+#include <openssl/rc4.h>
+#include <openssl/sha.h>
+#include <tinyclr/ssl_types.h>
+#ifdef OPENSSL_SYS_WINDOWS
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <intrin.h>
+#else
+#include <tinyhal.h>
+#endif
+
+#define SPEED_BUFFER_SIZE   1024
+#define SPEED_ITERATIONS    64
+
+#ifdef OPENSSL_SYS_WINDOWS
+typedef unsigned __int64 speed_cycles_t;
+
+static speed_cycles_t ssl_test_speed_cycles()
+{
+    return __rdtsc();
+}
+#else
+typedef UINT64 speed_cycles_t;
+
+static speed_cycles_t ssl_test_speed_cycles()
+{
+    return HAL_Time_CurrentTicks() * CPU_SystemClock() / CPU_TicksPerSecond();
+}
+#endif
+
+static unsigned char s_speedBuffer[SPEED_BUFFER_SIZE];
+
+static void ssl_test_speed_report(const char *name, speed_cycles_t start)
+{
+    speed_cycles_t cycles = ssl_test_speed_cycles() - start;
+    unsigned long  bytes  = (unsigned long)SPEED_BUFFER_SIZE * SPEED_ITERATIONS;
+
+    TINYCLR_SSL_PRINTF("%s: %lu.%lu cycles/byte\n", name,
+        (unsigned long)(cycles / bytes), (unsigned long)((cycles * 10 / bytes) % 10));
+}
+
+static void ssl_test_speed_cipher(const char *name, const EVP_CIPHER *cipher)
+{
+  unsigned char   key[EVP_MAX_KEY_LENGTH];
+  unsigned char   iv[EVP_MAX_IV_LENGTH];
+  int             len, i;
+  EVP_CIPHER_CTX  ctx;
+  speed_cycles_t  start;
+
+    TINYCLR_SSL_MEMSET(key,0x5a,sizeof(key));
+    TINYCLR_SSL_MEMSET(iv,0xa5,sizeof(iv));
+
+    EVP_CIPHER_CTX_init (&ctx);
+    EVP_EncryptInit_ex (&ctx,cipher,NULL,key,iv);
+
+    start = ssl_test_speed_cycles();
+
+    for (i=0;i<SPEED_ITERATIONS;i++)
+	EVP_EncryptUpdate (&ctx,s_speedBuffer,&len,s_speedBuffer,SPEED_BUFFER_SIZE);
+
+    ssl_test_speed_report(name,start);
+
+    EVP_CIPHER_CTX_cleanup (&ctx);
+}
+
+static void ssl_test_speed_digest(const char *name, const EVP_MD *md)
+{
+  unsigned char   out[EVP_MAX_MD_SIZE];
+  int             i;
+  EVP_MD_CTX      ctx;
+  speed_cycles_t  start;
+
+    EVP_MD_CTX_init (&ctx);
+    EVP_DigestInit_ex (&ctx,md,NULL);
+
+    start = ssl_test_speed_cycles();
+
+    for (i=0;i<SPEED_ITERATIONS;i++)
+	EVP_DigestUpdate (&ctx,s_speedBuffer,SPEED_BUFFER_SIZE);
+
+    EVP_DigestFinal_ex (&ctx,out,NULL);
+
+    ssl_test_speed_report(name,start);
+
+    EVP_MD_CTX_cleanup (&ctx);
+}
+
+int ssl_test_speed(int argc, char *argv[])
+{
+    TINYCLR_SSL_PRINTF("Cipher and digest speed, %d x %d bytes\n", SPEED_ITERATIONS, SPEED_BUFFER_SIZE);
+
+#ifndef OPENSSL_NO_AES
+    TINYCLR_SSL_PRINTF("(%s)\n", AES_options());
+    ssl_test_speed_cipher("aes-128-cbc", EVP_aes_128_cbc());
+    ssl_test_speed_cipher("aes-256-cbc", EVP_aes_256_cbc());
+#endif
+#ifndef OPENSSL_NO_RC4
+    ssl_test_speed_cipher("rc4", EVP_rc4());
+#endif
+#ifndef OPENSSL_NO_SHA1
+    ssl_test_speed_digest("sha1", EVP_sha1());
+#endif
+#ifndef OPENSSL_NO_SHA256
+    ssl_test_speed_digest("sha256", EVP_sha256());
+#endif
+
+    return 0;
+}
@@ -1,6 +1,7 @@
 #ifndef SSL_TESTS_H
 #define SSL_TESTS_H
 
+int ssl_test_aes(int, char**);
 int ssl_test_bf(int, char**);
 int ssl_test_bn(int, char**);
 int ssl_test_exp(int, char**);
@@ -30,6 +31,7 @@ int ssl_test_sha(int, char**);
 int ssl_test_sha1(int, char**);
 int ssl_test_sha256(int, char**);
 int ssl_test_sha512(int, char**);
+int ssl_test_speed(int, char**);
 int ssl_test_whrlpool(int, char**);
 int ssl_test_x509v3(int, char**);
 
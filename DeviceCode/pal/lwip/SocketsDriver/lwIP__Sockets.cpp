@@ -18,6 +18,7 @@ extern "C"
 }
 extern const HAL_CONFIG_BLOCK   g_NetworkConfigHeader;
 extern LOOPBACK_LWIP_Driver     g_LOOPBACK_LWIP_Driver;
+extern VIRTUAL_WIRE_LWIP_Driver g_VIRTUAL_WIRE_LWIP_Driver;
 extern NETWORK_CONFIG           g_NetworkConfig;
 
 //--// 
@@ -65,6 +66,12 @@ BOOL LWIP_SOCKETS_Driver::Initialize()
     g_LOOPBACK_LWIP_Driver.Open();
 #endif 
 
+#if defined(NETWORK_USE_VIRTUAL_WIRE)
+
+    /* Open the back to back netif pair used to benchmark the stack without a network */
+    g_VIRTUAL_WIRE_LWIP_Driver.Open();
+#endif
+
     for(i=0; i<g_NetworkConfig.NetworkInterfaceCount; i++)
     {
         int interfaceNumber;
@@ -113,6 +120,10 @@ BOOL LWIP_SOCKETS_Driver::Uninitialize()
     g_LOOPBACK_LWIP_Driver.Close();
 #endif        
 
+#if defined(NETWORK_USE_VIRTUAL_WIRE)
+    g_VIRTUAL_WIRE_LWIP_Driver.Close();
+#endif
+
     for(int i=0; i<g_NetworkConfig.NetworkInterfaceCount; i++)
     {
         Network_Interface_Close(i);
@@ -168,8 +179,14 @@ int LWIP_SOCKETS_Driver::Connect(SOCK_SOCKET socket, const SOCK_sockaddr* addres
 int LWIP_SOCKETS_Driver::Send(SOCK_SOCKET socket, const char* buf, int len, int flags) 
 { 
     NATIVE_PROFILE_PAL_NETWORK();
+    int nativeFlag = flags & ~SOCKET_WRITE_PARTIAL_OPTION;
+
+    if(flags & SOCKET_WRITE_PARTIAL_OPTION)
+    {
+        nativeFlag |= MSG_MORE;
+    }
         
-    return lwip_send(socket, (const void*)buf, len, flags);
+    return lwip_send(socket, (const void*)buf, len, nativeFlag);
 }
 
 
@@ -385,8 +402,10 @@ static void MARSHAL_FDSET_TO_SOCK_FDSET(SOCK_fd_set *sf, fd_set *f)
 {
     if(sf != NULL) 
     { 
+        int cnt = sf->fd_count;
+
         sf->fd_count = 0; 
-        for(int i=0; i<sf->fd_count; i++) 
+        for(int i=0; i<cnt; i++) 
         { 
             if(FD_ISSET(sf->fd_array[i],f)) 
             { 
@@ -765,6 +784,10 @@ int LWIP_SOCKETS_Driver::GetNativeTcpOption (int optname)
             nativeOptionName = TCP_KEEPALIVE;
             break;
 
+        case SOCK_TCP_SEGMENTS_SENT:
+            nativeOptionName = TCP_SEGS_SENT;
+            break;
+
         // allow the C# user to specify LWIP options that our managed enum
         // doesn't support
         default:
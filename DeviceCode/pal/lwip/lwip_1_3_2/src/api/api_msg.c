@@ -1005,6 +1005,7 @@ do_writemore(struct netconn *conn)
   void *dataptr;
   u16_t len, available;
   u8_t write_finished = 0;
+  u8_t apiflags;
   size_t diff;
 
   LWIP_ASSERT("conn->state == NETCONN_WRITE", (conn->state == NETCONN_WRITE));
@@ -1028,7 +1029,9 @@ do_writemore(struct netconn *conn)
 #endif
   }
 
-  err = tcp_write(conn->pcb.tcp, dataptr, len, conn->write_msg->msg.w.apiflags);
+  apiflags = conn->write_msg->msg.w.apiflags;
+
+  err = tcp_write(conn->pcb.tcp, dataptr, len, apiflags);
   LWIP_ASSERT("do_writemore: invalid length!", ((conn->write_offset + len) <= conn->write_msg->msg.w.len));
   if (err == ERR_OK) {
     conn->write_offset += len;
@@ -1040,7 +1043,14 @@ do_writemore(struct netconn *conn)
       /* API_EVENT might call tcp_tmr, so reset conn->state now */
       conn->state = NETCONN_NONE;
     }
-    err = tcp_output_nagle(conn->pcb.tcp);
+    //[MS_CHANGE] - the caller has more to write (MSG_MORE): leave the data queued so that the
+    //              following writes are chained into the same segments, the first write without
+    //              the flag (or the next timer) sends everything.
+    if (write_finished && (apiflags & NETCONN_MORE)) {
+      err = ERR_OK;
+    } else {
+      err = tcp_output_nagle(conn->pcb.tcp);
+    }
     conn->err = err;
     if ((err == ERR_OK) && (tcp_sndbuf(conn->pcb.tcp) <= TCP_SNDLOWAT)) {
       API_EVENT(conn, NETCONN_EVT_SENDMINUS, len);
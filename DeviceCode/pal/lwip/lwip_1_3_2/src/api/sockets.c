@@ -122,6 +122,15 @@ static sys_sem_t socksem;
 /** Semaphore protecting select_cb_list */
 static sys_sem_t selectsem;
 
+//[MS_CHANGE] - readiness of every socket, kept current by event_callback() (under selectsem) so that
+//              select only visits the sockets it was asked about instead of probing each one
+/** Sockets that are allocated */
+static fd_set sock_openset;
+/** Sockets with pending receive events (lastdata is checked separately) */
+static fd_set sock_readset;
+/** Sockets with room in their send buffer */
+static fd_set sock_writeset;
+
 /** Table to quickly map an lwIP error (err_t) to a socket error
   * by using -err as an index */
 static const int err_to_errno_table[] = {
@@ -180,6 +189,63 @@ lwip_socket_init(void)
   //[MS_CHANGE] - make sure the globals are initialized to zero
   select_cb_list = NULL;
   memset(sockets, 0, sizeof(struct lwip_socket) * NUM_SOCKETS);
+
+  FD_ZERO(&sock_openset);
+  FD_ZERO(&sock_readset);
+  FD_ZERO(&sock_writeset);
+}
+
+//[MS_CHANGE] - update the readiness sets from the socket's event counters, call with selectsem held
+static void
+sock_update_ready(int s, struct lwip_socket *sock)
+{
+  if (sock->rcvevent > 0)
+    FD_SET(s, &sock_readset);
+  else
+    FD_CLR(s, &sock_readset);
+
+  if (sock->sendevent)
+    FD_SET(s, &sock_writeset);
+  else
+    FD_CLR(s, &sock_writeset);
+}
+
+//[MS_CHANGE] - wake the select calls waiting on this socket, moved out of event_callback() so that
+//              lwip_recvfrom() can use it too; call without selectsem held
+static void
+sock_wake_select(int s, struct lwip_socket *sock)
+{
+  struct lwip_select_cb *scb;
+
+  /* Now decide if anyone is waiting for this socket */
+  /* NOTE: This code is written this way to protect the select link list
+     but to avoid a deadlock situation by releasing socksem before
+     signalling for the select. This means we need to go through the list
+     multiple times ONLY IF a select was actually waiting. We go through
+     the list the number of waiting select calls + 1. This list is
+     expected to be small. */
+  while (1) {
+    sys_sem_wait(selectsem);
+    for (scb = select_cb_list; scb; scb = scb->next) {
+      if (scb->sem_signalled == 0) {
+        /* Test this select call for our socket */
+        if (scb->readset && FD_ISSET(s, scb->readset))
+          if (sock->rcvevent > 0)
+            break;
+        if (scb->writeset && FD_ISSET(s, scb->writeset))
+          if (sock->sendevent)
+            break;
+      }
+    }
+    if (scb) {
+      scb->sem_signalled = 1;
+      sys_sem_signal(scb->sem);
+      sys_sem_signal(selectsem);
+    } else {
+      sys_sem_signal(selectsem);
+      break;
+    }
+  }
 }
 
 /**
@@ -235,6 +301,12 @@ alloc_socket(struct netconn *newconn)
       sockets[i].flags      = 0;
       sockets[i].err        = 0;
       sys_sem_signal(socksem);
+
+      //[MS_CHANGE] - publish the new socket to select
+      sys_sem_wait(selectsem);
+      FD_SET(i, &sock_openset);
+      sock_update_ready(i, &sockets[i]);
+      sys_sem_signal(selectsem);
       return i;
     }
   }
@@ -323,6 +395,11 @@ lwip_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
   newconn->socket = newsock;
   sys_sem_signal(socksem);
 
+  //[MS_CHANGE] - data that arrived before the accept makes the socket readable
+  sys_sem_wait(selectsem);
+  sock_update_ready(newsock, nsock);
+  sys_sem_signal(selectsem);
+
   LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_accept(%d) returning new sock=%d addr=", s, newsock));
   ip_addr_debug_print(SOCKETS_DEBUG, &naddr);
   LWIP_DEBUGF(SOCKETS_DEBUG, (" port=%"U16_F"\n", port));
@@ -390,6 +467,13 @@ lwip_close(int s)
   sock->conn       = NULL;
   sock_set_errno(sock, 0);
   sys_sem_signal(socksem);
+
+  //[MS_CHANGE] - a closed socket is reported as excepted by select
+  sys_sem_wait(selectsem);
+  FD_CLR(s, &sock_openset);
+  FD_CLR(s, &sock_readset);
+  FD_CLR(s, &sock_writeset);
+  sys_sem_signal(selectsem);
   return 0;
 }
 
@@ -481,7 +565,9 @@ lwip_recvfrom(int s, void *mem, size_t len, int flags,
 {
   struct lwip_socket *sock;
   struct netbuf      *buf;
-  u16_t               buflen, copylen, off = 0;
+  u16_t               buflen, copylen;
+  //[MS_CHANGE] - one call may drain several netbufs, so the total can exceed a single pbuf chain
+  int                 off = 0;
   struct ip_addr     *addr;
   u16_t               port;
   u8_t                done = 0;
@@ -517,6 +603,19 @@ lwip_recvfrom(int s, void *mem, size_t len, int flags,
 
       if (!buf) {
         if (off > 0) {
+          //[MS_CHANGE] - the end of the stream was fetched behind the data and took its receive event with
+          //              it; give the event back so the socket stays readable and the next call, which gets
+          //              NULL straight away from the closed netconn, returns 0. Publish it the way
+          //              event_callback() does, so select and Poll see the socket as readable.
+          if (sock->conn->err == ERR_CLSD) {
+            sys_sem_wait(selectsem);
+            sock->rcvevent++;
+            sock_update_ready(s, sock);
+            sys_sem_signal(selectsem);
+
+            sock_wake_select(s, sock);
+            sys_signal_sock_event();
+          }
           /* already received data, return that */
           sock_set_errno(sock, 0);
           return off;
@@ -550,8 +649,10 @@ lwip_recvfrom(int s, void *mem, size_t len, int flags,
     if (netconn_type(sock->conn) == NETCONN_TCP) {
       LWIP_ASSERT("invalid copylen, len would underflow", len >= copylen);
       len -= copylen;
+      //[MS_CHANGE] - keep copying while netbufs are already queued, even past a PSH boundary, so a
+      //              large receive drains everything received so far straight into the caller's buffer
+      //              in one call; only an empty queue ends the call early.
       if ( (len <= 0) || 
-           (buf->p->flags & PBUF_FLAG_PUSH) || 
            (sock->rcvevent <= 0) || 
            ((flags & MSG_PEEK)!=0)) {
         done = 1;
@@ -864,51 +965,41 @@ lwip_write(int s, const void *data, size_t size)
 static int
 lwip_selscan(int maxfdp1, fd_set *readset, fd_set *writeset, fd_set *exceptset)
 {
-  int i, nready = 0;
+  int i, b, nready = 0;
   fd_set lreadset, lwriteset, lexceptset;
-  struct lwip_socket *p_sock;
+  u8_t req, mask, pending, ready;
   
   FD_ZERO(&lreadset);
   FD_ZERO(&lwriteset);
   FD_ZERO(&lexceptset);
   
-  /* Go through each socket in each list to count number of sockets which
-  currently match */
-  for(i = 0; i < maxfdp1; i++) {
-    if (FD_ISSET(i, readset)) {
-      /* See if netconn of this socket is ready for read */
-      p_sock = get_socket(i);
-      if (p_sock) {
-        if((p_sock->lastdata || (p_sock->rcvevent > 0))) {
-          FD_SET(i, &lreadset);
-          LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_selscan: fd=%d ready for reading\n", i));
-          nready++;
-        }
-      }
-      //[MS_CHANGE] - make sure that we return an excepted state if the socket has been closed 
-      else {
-        FD_SET(i, &lexceptset);
-        LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_selscan: fd=%d ready for exception\n", i));
-        nready++;
-      }
-    }
-    if (FD_ISSET(i, writeset)) {
-      /* See if netconn of this socket is ready for write */
-      p_sock = get_socket(i);
-      if (p_sock) {
-        if(p_sock->sendevent) {
-          FD_SET(i, &lwriteset);
-          LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_selscan: fd=%d ready for writing\n", i));
-          nready++;
-        }
-      }
-      //[MS_CHANGE] - make sure that we return an excepted state if the socket has been closed 
-      else if(!FD_ISSET(i, &lexceptset)) {
-        FD_SET(i, &lexceptset);
-        LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_selscan: fd=%d ready for exception\n", i));
-        nready++;
+  //[MS_CHANGE] - match the requested sockets against the readiness sets kept by event_callback,
+  //              eight sockets at a time, instead of looking up every socket index
+  for(b = 0; b * 8 < maxfdp1 && b < (int)sizeof(lreadset.fd_bits); b++) {
+    mask = (maxfdp1 - b * 8 >= 8) ? 0xFF : (u8_t)((1 << (maxfdp1 - b * 8)) - 1);
+    req  = (readset->fd_bits[b] | writeset->fd_bits[b]) & mask;
+
+    if (req == 0)
+      continue;
+
+    lreadset.fd_bits[b]  = readset->fd_bits[b]  & mask & sock_openset.fd_bits[b] & sock_readset.fd_bits[b];
+    lwriteset.fd_bits[b] = writeset->fd_bits[b] & mask & sock_openset.fd_bits[b] & sock_writeset.fd_bits[b];
+
+    //[MS_CHANGE] - make sure that we return an excepted state if the socket has been closed 
+    lexceptset.fd_bits[b] = req & ~sock_openset.fd_bits[b];
+
+    /* data left over from a previous read does not raise an event, so look at those sockets directly */
+    pending = readset->fd_bits[b] & mask & sock_openset.fd_bits[b] & ~lreadset.fd_bits[b];
+
+    for(i = 0; pending != 0; i++, pending >>= 1) {
+      if ((pending & 1) && sockets[b * 8 + i].lastdata) {
+        lreadset.fd_bits[b] |= (u8_t)(1 << i);
       }
     }
+
+    for(ready = lreadset.fd_bits[b]  ; ready != 0; ready &= ready - 1) nready++;
+    for(ready = lwriteset.fd_bits[b] ; ready != 0; ready &= ready - 1) nready++;
+    for(ready = lexceptset.fd_bits[b]; ready != 0; ready &= ready - 1) nready++;
   }
   *readset = lreadset;
   *writeset = lwriteset;
@@ -1077,7 +1168,6 @@ event_callback(struct netconn *conn, enum netconn_evt evt, u16_t len)
 {
   int s;
   struct lwip_socket *sock;
-  struct lwip_select_cb *scb;
 
   LWIP_UNUSED_ARG(len);
 
@@ -1129,37 +1219,12 @@ event_callback(struct netconn *conn, enum netconn_evt evt, u16_t len)
       LWIP_ASSERT("unknown event", 0);
       break;
   }
+  //[MS_CHANGE] - keep the readiness sets current for select
+  sock_update_ready(s, sock);
   sys_sem_signal(selectsem);
 
-  /* Now decide if anyone is waiting for this socket */
-  /* NOTE: This code is written this way to protect the select link list
-     but to avoid a deadlock situation by releasing socksem before
-     signalling for the select. This means we need to go through the list
-     multiple times ONLY IF a select was actually waiting. We go through
-     the list the number of waiting select calls + 1. This list is
-     expected to be small. */
-  while (1) {
-    sys_sem_wait(selectsem);
-    for (scb = select_cb_list; scb; scb = scb->next) {
-      if (scb->sem_signalled == 0) {
-        /* Test this select call for our socket */
-        if (scb->readset && FD_ISSET(s, scb->readset))
-          if (sock->rcvevent > 0)
-            break;
-        if (scb->writeset && FD_ISSET(s, scb->writeset))
-          if (sock->sendevent)
-            break;
-      }
-    }
-    if (scb) {
-      scb->sem_signalled = 1;
-      sys_sem_signal(scb->sem);
-      sys_sem_signal(selectsem);
-    } else {
-      sys_sem_signal(selectsem);
-      break;
-    }
-  }
+  //[MS_CHANGE] - shared with lwip_recvfrom()
+  sock_wake_select(s, sock);
   
 // [MS_CHANGE] - Signal the CLR that a socket event has occured
 //               TODO: We may want to investigate other was to signal
@@ -1356,6 +1421,8 @@ lwip_getsockopt(int s, int level, int optname, void *optval, socklen_t *optlen)
     case TCP_KEEPINTVL:
     case TCP_KEEPCNT:
 #endif /* LWIP_TCP_KEEPALIVE */
+    //[MS_CHANGE] - read only segment count
+    case TCP_SEGS_SENT:
       break;
        
     default:
@@ -1585,6 +1652,13 @@ lwip_getsockopt_internal(void *arg)
       break;
 #endif /* LWIP_TCP_KEEPALIVE */
 
+    //[MS_CHANGE] - read only segment count
+    case TCP_SEGS_SENT:
+      *(int*)optval = (int)sock->conn->pcb.tcp->segs_sent;
+      LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_getsockopt(%d, IPPROTO_TCP, TCP_SEGS_SENT) = %d\n",
+                  s, *(int *)optval));
+      break;
+
     }  /* switch (optname) */
     break;
 #endif /* LWIP_TCP */
@@ -120,6 +120,8 @@
 #define DNS_STATE_NEW             1
 #define DNS_STATE_ASKING          2
 #define DNS_STATE_DONE            3
+//[MS_CHANGE] - negative caching: the lookup failed, kept for DNS_NEGATIVE_TTL seconds
+#define DNS_STATE_FAILED          4
 
 #ifdef PACK_STRUCT_USE_INCLUDES
 #  include "arch\bpstruct.h"
@@ -185,6 +187,7 @@ struct dns_table_entry {
   u8_t  retries;
   u8_t  seqno;
   u8_t  err;
+  u8_t  answered; //[MS_CHANGE] - set until the caller that waited collects the result
   u32_t ttl;
   char name[DNS_MAX_NAME_LENGTH];
   struct ip_addr ipaddr;
@@ -246,6 +249,9 @@ static struct ip_addr         dns_servers[DNS_MAX_SERVERS];
 static u8_t                   dns_payload[DNS_MSG_SIZE];
 #endif /* (DNS_USES_STATIC_BUF == 1) */
 
+u32_t                         dns_cache_hits;
+u32_t                         dns_cache_misses;
+
 /**
  * Initialize the resolver: set up the UDP pcb and configure the default server
  * (DNS_SERVER_ADDRESS).
@@ -263,6 +269,9 @@ dns_init()
   //[MS_CHANGE] - Always initialize globals on dns_init  to support soft reboot
   memset(dns_table, 0, sizeof(dns_table));
   memset(dns_servers, 0, sizeof(dns_servers));
+  dns_seqno        = 0;
+  dns_cache_hits   = 0;
+  dns_cache_misses = 0;
 #if (DNS_USES_STATIC_BUF == 1)
   memset(dns_payload, 0, sizeof(dns_payload));
 #endif
@@ -485,6 +494,13 @@ dns_lookup(const char *name)
       LWIP_DEBUGF(DNS_DEBUG, ("dns_lookup: \"%s\": found = ", name));
       ip_addr_debug_print(DNS_DEBUG, &(dns_table[i].ipaddr));
       LWIP_DEBUGF(DNS_DEBUG, ("\n"));
+      //[MS_CHANGE] - a hit makes the entry the most recently used, dns_enqueue replaces the least
+      dns_table[i].seqno = dns_seqno++;
+      if (dns_table[i].answered) {
+        dns_table[i].answered = 0;
+      } else {
+        dns_cache_hits++;
+      }
       return dns_table[i].ipaddr.addr;
     }
   }
@@ -492,6 +508,54 @@ dns_lookup(const char *name)
   return INADDR_NONE;
 }
 
+//[MS_CHANGE] - negative caching
+/**
+ * Look up a name in the failed entries of the dns_table.
+ *
+ * @param name the hostname to look up
+ * @return 1 if a lookup of this name failed less than DNS_NEGATIVE_TTL seconds ago
+ */
+static u8_t
+dns_lookup_failed(const char *name)
+{
+  u8_t i;
+
+  for (i = 0; i < DNS_TABLE_SIZE; ++i) {
+    if ((dns_table[i].state == DNS_STATE_FAILED) &&
+        (strcmp(name, dns_table[i].name) == 0)) {
+      LWIP_DEBUGF(DNS_DEBUG, ("dns_lookup_failed: \"%s\": cached failure\n", name));
+      dns_table[i].seqno = dns_seqno++;
+      if (dns_table[i].answered) {
+        dns_table[i].answered = 0;
+      } else {
+        dns_cache_hits++;
+      }
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+/**
+ * Retire an entry whose lookup failed: keep it as a cached failure if
+ * DNS_NEGATIVE_TTL is set, otherwise free it.
+ *
+ * @param pEntry the dns_table entry
+ */
+static void
+dns_entry_failed(struct dns_table_entry *pEntry)
+{
+#if DNS_NEGATIVE_TTL
+  pEntry->state    = DNS_STATE_FAILED;
+  pEntry->ttl      = DNS_NEGATIVE_TTL;
+  pEntry->answered = 1;
+#else
+  pEntry->state = DNS_STATE_UNUSED;
+#endif
+  pEntry->found = NULL;
+}
+
 #if DNS_DOES_NAME_CHECK
 /**
  * Compare the "dotted" name "query" with the encoded name "response"
@@ -692,8 +756,7 @@ dns_check_entry(u8_t i)
             if (pEntry->found)
               (*pEntry->found)(pEntry->name, NULL, pEntry->arg);
             /* flush this entry */
-            pEntry->state   = DNS_STATE_UNUSED;
-            pEntry->found   = NULL;
+            dns_entry_failed(pEntry);
             break;
           }
         }
@@ -717,9 +780,12 @@ dns_check_entry(u8_t i)
       break;
     }
 
-    case DNS_STATE_DONE: {
+    //[MS_CHANGE] - failed entries age out like resolved ones; a TTL of 0 from
+    // the server must expire on the next tick rather than wrap around
+    case DNS_STATE_DONE:
+    case DNS_STATE_FAILED: {
       /* if the time to live is nul */
-      if (--pEntry->ttl == 0) {
+      if ((pEntry->ttl == 0) || (--pEntry->ttl == 0)) {
         LWIP_DEBUGF(DNS_DEBUG, ("dns_check_entry: \"%s\": flush\n", pEntry->name));
         /* flush this entry */
         pEntry->state = DNS_STATE_UNUSED;
@@ -848,6 +914,7 @@ dns_recv(void *arg, struct udp_pcb *pcb, struct pbuf *p, struct ip_addr *addr, u
             }
             /* read the IP address after answer resource record's header */
             MEMCPY( &(pEntry->ipaddr), (pHostname+SIZEOF_DNS_ANSWER), sizeof(struct ip_addr));
+            pEntry->answered = 1;
             LWIP_DEBUGF(DNS_DEBUG, ("dns_recv: \"%s\": response = ", pEntry->name));
             ip_addr_debug_print(DNS_DEBUG, (&(pEntry->ipaddr)));
             LWIP_DEBUGF(DNS_DEBUG, ("\n"));
@@ -878,8 +945,7 @@ responseerr:
     (*pEntry->found)(pEntry->name, NULL, pEntry->arg);
   }
   /* flush this entry */
-  pEntry->state = DNS_STATE_UNUSED;
-  pEntry->found = NULL;
+  dns_entry_failed(pEntry);
 
 memerr2:
 #if (DNS_USES_STATIC_BUF == 2)
@@ -908,6 +974,18 @@ dns_enqueue(const char *name, dns_found_callback found, void *callback_arg)
   u8_t lseq, lseqi;
   struct dns_table_entry *pEntry = NULL;
 
+  // [MS_CHANGE] - asynchronous dns for tinyclr
+  // we may already have an entry for this item 
+  // from a previous call, if so, return in progress
+  // (look through the whole table first, an unused entry may come before it)
+  for (i = 0; i < DNS_TABLE_SIZE; ++i) {
+    pEntry = &dns_table[i];
+    if ((pEntry->state != DNS_STATE_UNUSED) && (strcmp(pEntry->name, name) == 0))
+    {
+        return ERR_INPROGRESS;
+    }
+  }
+
   /* search an unused entry, or the oldest one */
   lseq = lseqi = 0;
   for (i = 0; i < DNS_TABLE_SIZE; ++i) {
@@ -916,16 +994,8 @@ dns_enqueue(const char *name, dns_found_callback found, void *callback_arg)
     if (pEntry->state == DNS_STATE_UNUSED)
       break;
 
-    // [MS_CHANGE] - asynchronous dns for tinyclr
-    // we may already have an entry for this item 
-    // from a previous call, if so, return in progress
-    if(strcmp(pEntry->name, name) == 0)
-    {
-        return ERR_INPROGRESS;
-    }
-
     /* check if this is the oldest completed entry */
-    if (pEntry->state == DNS_STATE_DONE) {
+    if ((pEntry->state == DNS_STATE_DONE) || (pEntry->state == DNS_STATE_FAILED)) {
       if ((dns_seqno - pEntry->seqno) > lseq) {
         lseq = dns_seqno - pEntry->seqno;
         lseqi = i;
@@ -935,7 +1005,8 @@ dns_enqueue(const char *name, dns_found_callback found, void *callback_arg)
 
   /* if we don't have found an unused entry, use the oldest completed one */
   if (i == DNS_TABLE_SIZE) {
-    if ((lseqi >= DNS_TABLE_SIZE) || (dns_table[lseqi].state != DNS_STATE_DONE)) {
+    if ((lseqi >= DNS_TABLE_SIZE) ||
+        ((dns_table[lseqi].state != DNS_STATE_DONE) && (dns_table[lseqi].state != DNS_STATE_FAILED))) {
       /* no entry can't be used now, table is full */
       LWIP_DEBUGF(DNS_DEBUG, ("dns_enqueue: \"%s\": DNS entries table is full\n", name));
       return ERR_MEM;
@@ -949,9 +1020,12 @@ dns_enqueue(const char *name, dns_found_callback found, void *callback_arg)
   /* use this entry */
   LWIP_DEBUGF(DNS_DEBUG, ("dns_enqueue: \"%s\": use DNS entry %"U16_F"\n", name, (u16_t)(i)));
 
+  dns_cache_misses++;
+
   /* fill the entry */
   pEntry->state = DNS_STATE_NEW;
   pEntry->seqno = dns_seqno++;
+  pEntry->answered = 0;
   pEntry->found = found;
   pEntry->arg   = callback_arg;
   strcpy(pEntry->name, name);
@@ -1000,13 +1074,21 @@ dns_gethostbyname(const char *hostname, struct ip_addr *addr, dns_found_callback
   }
 #endif /* LWIP_HAVE_LOOPIF */
 
-  /* host name already in octet notation? set ip addr and return ERR_OK
-   * already have this address cached? */
-  if (((addr->addr = inet_addr(hostname)) != INADDR_NONE) ||
-      ((addr->addr = dns_lookup(hostname)) != INADDR_NONE)) {
+  /* host name already in octet notation? set ip addr and return ERR_OK */
+  if ((addr->addr = inet_addr(hostname)) != INADDR_NONE) {
     return ERR_OK;
   }
 
+  /* already have this address cached? */
+  if ((addr->addr = dns_lookup(hostname)) != INADDR_NONE) {
+    return ERR_OK;
+  }
+
+  //[MS_CHANGE] - fail at once on a cached failure
+  if (dns_lookup_failed(hostname)) {
+    return ERR_VAL;
+  }
+
   /* queue query with specified callback */
   return dns_enqueue(hostname, found, callback_arg);
 }
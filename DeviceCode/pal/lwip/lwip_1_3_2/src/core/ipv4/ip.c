@@ -83,6 +83,18 @@ ip_route(struct ip_addr *dest)
 {
   struct netif *netif;
 
+  //[MS_CHANGE] - A virtual wire netif is the route to its peer (held in gw), even when
+  // the peer's address is also local; this is what lets the pair in the loopback driver
+  // carry traffic between two addresses of the same stack. Other point to point netifs
+  // are routed as before.
+  for(netif = netif_list; netif != NULL; netif = netif->next) {
+    if (netif_is_up(netif) && (netif->flags & NETIF_FLAG_VIRTUAL_WIRE)) {
+      if (ip_addr_cmp(dest, &(netif->gw))) {
+        return netif;
+      }
+    }
+  }
+
   /* iterate through netifs */
   for(netif = netif_list; netif != NULL; netif = netif->next) {
     /* network mask matches? */
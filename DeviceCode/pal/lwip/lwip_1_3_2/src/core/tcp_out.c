@@ -752,6 +752,8 @@ tcp_output_segment(struct tcp_seg *seg, struct tcp_pcb *pcb)
              IP_PROTO_TCP, seg->p->tot_len);
 #endif
   TCP_STATS_INC(tcp.xmit);
+  //[MS_CHANGE] - per connection count of the segments above, bare ACKs go out through tcp_output() instead
+  pcb->segs_sent++;
 
 #if LWIP_NETIF_HWADDRHINT
   ip_output_hinted(seg->p, &(pcb->local_ip), &(pcb->remote_ip), pcb->ttl, pcb->tos,
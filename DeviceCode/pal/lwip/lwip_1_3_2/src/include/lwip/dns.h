@@ -86,6 +86,10 @@ struct ip_addr dns_getserver(u8_t numdns);
 err_t          dns_gethostbyname(const char *hostname, struct ip_addr *addr,
                                  dns_found_callback found, void *callback_arg);
 
+//[MS_CHANGE] - lookups answered from the table versus queries sent, for sizing DNS_TABLE_SIZE
+extern u32_t   dns_cache_hits;
+extern u32_t   dns_cache_misses;
+
 #if DNS_LOCAL_HOSTLIST && DNS_LOCAL_HOSTLIST_IS_DYNAMIC
 int            dns_local_removehost(const char *hostname, const struct ip_addr *addr);
 err_t          dns_local_addhost(const char *hostname, const struct ip_addr *addr);
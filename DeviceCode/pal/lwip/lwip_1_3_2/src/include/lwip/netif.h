@@ -80,6 +80,8 @@ extern "C" {
 #define NETIF_FLAG_ETHARP       0x20U
 /** if set, the netif has IGMP capability */
 #define NETIF_FLAG_IGMP         0x40U
+//[MS_CHANGE] - set by the loopback driver's virtual wire pair, whose peer (gw) is routed over the netif
+#define NETIF_FLAG_VIRTUAL_WIRE 0x80U
 
 /** Generic data structure used for all lwIP network interfaces.
  *  The following fields should be filled in by the initialization
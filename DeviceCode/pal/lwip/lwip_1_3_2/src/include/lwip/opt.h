@@ -667,6 +667,14 @@ extern void* private_realloc(void* ptr, unsigned int size);
 #define DNS_TABLE_SIZE                  4
 #endif
 
+//[MS_CHANGE] - negative caching
+/** DNS_NEGATIVE_TTL: seconds a failed lookup (name error, no address record or
+ * no answer from any server) is remembered, so that retrying the same name
+ * fails at once instead of querying again. 0 disables negative caching. */
+#ifndef DNS_NEGATIVE_TTL
+#define DNS_NEGATIVE_TTL                10
+#endif
+
 /** DNS maximum host name length supported in the name table. */
 #ifndef DNS_MAX_NAME_LENGTH
 #define DNS_MAX_NAME_LENGTH             256
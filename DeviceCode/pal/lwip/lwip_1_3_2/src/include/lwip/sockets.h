@@ -149,6 +149,8 @@ struct linger {
 #define TCP_KEEPIDLE   0x03    /* set pcb->keep_idle  - Same as TCP_KEEPALIVE, but use seconds for get/setsockopt */
 #define TCP_KEEPINTVL  0x04    /* set pcb->keep_intvl - Use seconds for get/setsockopt */
 #define TCP_KEEPCNT    0x05    /* set pcb->keep_cnt   - Use number of probes sent for get/setsockopt */
+//[MS_CHANGE] - read only, number of segments the connection has sent (pcb->segs_sent)
+#define TCP_SEGS_SENT  0x7101
 #endif /* LWIP_TCP */
 
 #if LWIP_UDP && LWIP_UDPLITE
@@ -357,6 +357,9 @@ struct tcp_pcb {
 
   // [MS_CHANGE] - Added support for linger socket option
   u16_t linger;
+
+  // [MS_CHANGE] - segments carrying data, SYN or FIN put on the wire, read through the TCP_SEGS_SENT socket option
+  u32_t segs_sent;
   
   /* These are ordered by sequence number: */
   struct tcp_seg *unsent;   /* Unsent (queued) segments. */
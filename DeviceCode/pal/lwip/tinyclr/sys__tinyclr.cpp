@@ -40,87 +40,113 @@ struct sys_timeouts *sys_arch_timeouts(void)
 //--//
 //--// Semaphore functions. 
 //--//
+//--// There is a single native thread, so a thread blocked on a semaphore is the innermost
+//--// Events_WaitForEvents on the stack and any other waiter is nested further out.  Each
+//--// semaphore counts its own waiters so that a signal nobody is waiting for does not wake
+//--// the system, and a waiter that leaves hands the wakeup on to the enclosing ones.
+//--//
 
-void AcquireSemaphore(volatile UINT32* semaphore)
+struct SysSemaphore
 {
-    *semaphore = *semaphore - 1;
-}
+    volatile UINT32 Count;
+    volatile UINT32 Waiters;
+};
 
-void ReleaseSemaphore(volatile UINT32* semaphore)
-{
-    *semaphore = *semaphore + 1;
-}
+static UINT32 s_semaphoreWaiters = 0;
 
-bool IsSemaphoreGreen(volatile UINT32* semaphore)
+static void ReleaseWaiter(SysSemaphore* semaphore)
 {
-    return *semaphore != 0;
+    semaphore->Waiters--;
+    s_semaphoreWaiters--;
+
+    // an enclosing wait may have had its event consumed by us; let it check its own count
+    if(s_semaphoreWaiters != 0)
+    {
+        Events_Set(SYSTEM_EVENT_FLAG_NETWORK);
+    }
 }
 
 sys_sem_t sys_sem_new(u8_t count)
 {
-    //return dummy_semaphore;
-    volatile UINT32* semaphore = (volatile UINT32*)mem_malloc(sizeof(UINT32));
-    *semaphore = count;
+    SysSemaphore* semaphore = (SysSemaphore*)mem_malloc(sizeof(SysSemaphore));
+
+    if(semaphore == NULL) return SYS_SEM_NULL;
+
+    semaphore->Count   = count;
+    semaphore->Waiters = 0;
 
     return (sys_sem_t)semaphore;
 }
 
 void sys_sem_signal(sys_sem_t sem)
 {
-    volatile UINT32* semaphore = (volatile UINT32*)sem;
-    ReleaseSemaphore(semaphore);
-    Events_Set(SYSTEM_EVENT_FLAG_NETWORK);
+    SysSemaphore* semaphore = (SysSemaphore*)sem;
+
+    semaphore->Count++;
+
+    if(semaphore->Waiters != 0)
+    {
+        Events_Set(SYSTEM_EVENT_FLAG_NETWORK);
+    }
 }
 
 u32_t sys_arch_sem_wait(sys_sem_t sem, u32_t timeout)
 {
-    volatile UINT32* semaphore = (volatile UINT32*)sem;
+    SysSemaphore* semaphore = (SysSemaphore*)sem;
 
-    if(timeout != 0) 
+    if(semaphore->Count != 0)
     {
-        INT64 now = ::HAL_Time_CurrentTime();
-        INT64 elapsed = now + (timeout * 10000);
-        
-        while(elapsed > ::HAL_Time_CurrentTime()) 
+        semaphore->Count--;
+        return 0;
+    }
+
+    // read the clock once per wakeup and only ever sleep for what is left of the timeout
+    INT64 start    = ::HAL_Time_CurrentTime();
+    INT64 deadline = start + (INT64)timeout * 10000;
+    INT64 now      = start;
+
+    semaphore->Waiters++;
+    s_semaphoreWaiters++;
+
+    while(semaphore->Count == 0)
+    {
+        UINT32 waitMs = EVENTS_TIMEOUT_INFINITE;
+
+        if(timeout != 0)
         {
-            if(IsSemaphoreGreen(semaphore)) 
+            if(now >= deadline)
             {
-                AcquireSemaphore(semaphore); 
-                break;
+                ReleaseWaiter(semaphore);
+                return SYS_ARCH_TIMEOUT;
             }
 
-            if(Events_WaitForEvents(SYSTEM_EVENT_FLAG_NETWORK, timeout))
-            {
-                Events_Clear(SYSTEM_EVENT_FLAG_NETWORK);
-            }
+            // round up so we never wake just short of the deadline
+            waitMs = (UINT32)((deadline - now + 9999) / 10000);
         }
-    }
-    else
-    {
-        while(1) 
+
+        // continuations, including the tcpip thread, run while we wait here
+        if(Events_WaitForEvents(SYSTEM_EVENT_FLAG_NETWORK, waitMs))
         {
-            // wait and call the continuation for tcpip_thread
-            if(IsSemaphoreGreen(semaphore)) 
-            {
-                AcquireSemaphore(semaphore);
-                break;
-            }
-            
-            Events_WaitForEvents(SYSTEM_EVENT_FLAG_NETWORK, EVENTS_TIMEOUT_INFINITE);
             Events_Clear(SYSTEM_EVENT_FLAG_NETWORK);
         }
+
+        now = ::HAL_Time_CurrentTime();
     }
-    
-    return *semaphore;
+
+    semaphore->Count--;
+
+    ReleaseWaiter(semaphore);
+
+    return (u32_t)((now - start) / 10000);
 }
 
 void sys_sem_free(sys_sem_t sem)
 {
-    volatile UINT32* semaphore = (volatile UINT32*)sem;
+    SysSemaphore* semaphore = (SysSemaphore*)sem;
 
-    *semaphore = 0;
+    semaphore->Count = 0;
     
-    mem_free(sem);
+    mem_free(semaphore);
 }
 
 //--//
@@ -183,6 +209,7 @@ void sys_mbox_post(sys_mbox_t mbox, void *msg)
         node->payload = msg;
     }
 
+    // coalesced with any run of the tcpip thread that is already queued
     SOCKETS_RestartTcpIpProcessor(0);
 }
 
@@ -214,10 +241,8 @@ u32_t sys_arch_mbox_fetch(sys_mbox_t mbox, void **msg, u32_t timeout)
 {
     Hal_Queue_UnknownSize<OpaqueQueueNode>* queue = (Hal_Queue_UnknownSize<OpaqueQueueNode>*)mbox;
 
-    // TODO
-    // TODO
-    // TODO
-    // implement timeout
+    // The fetch never blocks: the tcpip thread is a continuation that drains the mailbox
+    // and then returns, to be restarted by the next post or when the next lwIP timeout is due.
     OpaqueQueueNode* node = queue->Pop();
 
     if(node) 
@@ -259,9 +259,10 @@ int RTIP_SOCKETS_Driver::Send(SOCK_SOCKET socket, const char* buf, int len, int
     int ret;
     
     
+    // RTIP has no way to hold back a partial write, send it right away
     ret = (int) rtp_net_send ((RTP_HANDLE) socket, 
                         (const unsigned char *) buf, 
-                        len, flags);
+                        len, flags & ~SOCKET_WRITE_PARTIAL_OPTION);
                         
     return ret;
 }
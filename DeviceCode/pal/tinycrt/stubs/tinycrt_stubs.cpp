@@ -35,6 +35,13 @@ int hal_snprintf_double( char* buffer, size_t len, const char* format, double d
     return 0;
 }
 
+double hal_strtod( const char* str, char** endptr )
+{
+    NATIVE_PROFILE_PAL_CRT();
+    if(endptr) *endptr = (char*)str;
+    return 0;
+}
+
 #else
 int hal_snprintf_float( char* buffer, size_t len, const char* format, INT32 f )
 {
@@ -3,6 +3,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <tinyhal.h>
+#include <stdlib.h>
 
 //--//
 /* ADS Specific functions to avoid the semihosting environment              */
@@ -256,6 +257,13 @@ int hal_snprintf_double( char* buffer, size_t len, const char* format, double d
 #endif    
 }
 
+double hal_strtod( const char* str, char** endptr )
+{
+    NATIVE_PROFILE_PAL_CRT();
+
+    return strtod( str, endptr );
+}
+
 
 #else
 
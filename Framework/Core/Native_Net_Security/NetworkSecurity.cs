@@ -93,6 +93,11 @@ namespace Microsoft.SPOT.Net.Security
 
     internal static class SslNative
     {
+        // SetOption options, matching SSL_OPTION__XXX in Sockets_decl.h
+        internal const int c_OptionClientSessionCache = 1;
+        internal const int c_OptionServerSessionCache = 2;
+        internal const int c_OptionReadAhead          = 3;
+
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
         internal static extern int SecureServerInit(int sslProtocols, int sslCertVerify, X509Certificate certificate, X509Certificate[] ca);
 
@@ -125,6 +130,12 @@ namespace Microsoft.SPOT.Net.Security
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
         internal static extern int DataAvailable(object socket);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        internal static extern bool SetOption(int contextHandle, int option, int value);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        internal static extern int SessionReused(object socket);
     }
 }
 
@@ -62,6 +62,84 @@ namespace System.Net
 
             return ipHostEntry;
         }
+
+        /// <summary>
+        /// Starts resolving a host name on a worker thread.  Names the network stack has
+        /// cached complete at once; others take a round trip to the DNS server.
+        /// </summary>
+        /// <param name="hostNameOrAddress">The host name or IP address to resolve.</param>
+        /// <param name="requestCallback">Called when the lookup completes, may be null.</param>
+        /// <param name="state">Passed back to the callback through the result.</param>
+        /// <returns>The result to hand to EndGetHostEntry.</returns>
+        public static IAsyncResult BeginGetHostEntry(string hostNameOrAddress, AsyncCallback requestCallback, object state)
+        {
+            GetHostEntryAsyncResult result = new GetHostEntryAsyncResult(hostNameOrAddress, requestCallback, state);
+
+            new Thread(result.Resolve).Start();
+
+            return result;
+        }
+
+        /// <summary>
+        /// Waits for a lookup started by BeginGetHostEntry and returns its result, or throws
+        /// the exception GetHostEntry would have thrown.
+        /// </summary>
+        public static IPHostEntry EndGetHostEntry(IAsyncResult asyncResult)
+        {
+            GetHostEntryAsyncResult result = asyncResult as GetHostEntryAsyncResult;
+
+            if (result == null) throw new ArgumentException();
+
+            result.m_completed.WaitOne();
+
+            if (result.m_exception != null) throw result.m_exception;
+
+            return result.m_hostEntry;
+        }
+
+        private class GetHostEntryAsyncResult : IAsyncResult
+        {
+            internal readonly ManualResetEvent m_completed = new ManualResetEvent(false);
+            internal IPHostEntry               m_hostEntry;
+            internal Exception                 m_exception;
+
+            private readonly string        m_hostNameOrAddress;
+            private readonly AsyncCallback m_callback;
+            private readonly object        m_state;
+
+            internal GetHostEntryAsyncResult(string hostNameOrAddress, AsyncCallback callback, object state)
+            {
+                m_hostNameOrAddress = hostNameOrAddress;
+                m_callback          = callback;
+                m_state             = state;
+            }
+
+            public object AsyncState
+            {
+                get { return m_state; }
+            }
+
+            public bool IsCompleted
+            {
+                get { return m_completed.WaitOne(0, false); }
+            }
+
+            internal void Resolve()
+            {
+                try
+                {
+                    m_hostEntry = GetHostEntry(m_hostNameOrAddress);
+                }
+                catch (Exception e)
+                {
+                    m_exception = e;
+                }
+
+                m_completed.Set();
+
+                if (m_callback != null) m_callback(this);
+            }
+        }
     }
 }
 
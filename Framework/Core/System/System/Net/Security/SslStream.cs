@@ -17,6 +17,12 @@ namespace Microsoft.SPOT.Net.Security
         private int _sslContext;
         private bool _isServer;
 
+        // Optional write coalescing, every record costs a MAC, an encryption and a TCP segment
+        private byte[] _writeBuffer;
+        private int _writeCount;
+
+        private bool _readAhead;
+
         //--//
 
         public SslStream(Socket socket)
@@ -29,6 +35,7 @@ namespace Microsoft.SPOT.Net.Security
 
             _sslContext = -1;
             _isServer = false;
+            _readAhead = true;
         }
         
         public void AuthenticateAsClient(string targetHost, params SslProtocols[] sslProtocols)
@@ -78,14 +85,17 @@ namespace Microsoft.SPOT.Net.Security
 
             try
             {
+                // a driver without the option reads one record at a time
                 if (isServer)
                 {
                     _sslContext = SslNative.SecureServerInit((int)vers, (int)verify, certificate, ca);
+                    SslNative.SetOption(_sslContext, SslNative.c_OptionReadAhead, _readAhead ? 1 : 0);
                     SslNative.SecureAccept(_sslContext, _socket);
                 }
                 else
                 {
                     _sslContext = SslNative.SecureClientInit((int)vers, (int)verify, certificate, ca);
+                    SslNative.SetOption(_sslContext, SslNative.c_OptionReadAhead, _readAhead ? 1 : 0);
                     SslNative.SecureConnect(_sslContext, targetHost, _socket);
                 }
             }
@@ -103,6 +113,95 @@ namespace Microsoft.SPOT.Net.Security
 
         public bool IsServer { get { return _isServer; } }
 
+        /// <summary>
+        /// True when the handshake resumed an earlier session instead of negotiating a new one.
+        /// Throws NotSupportedException when the SSL driver cannot tell.
+        /// </summary>
+        public bool IsSessionReused
+        {
+            get
+            {
+                if (_disposed) throw new ObjectDisposedException();
+                if (_sslContext == -1) throw new InvalidOperationException();
+
+                int reused = SslNative.SessionReused(_socket);
+
+                if (reused < 0) throw new NotSupportedException();
+
+                return reused > 0;
+            }
+        }
+
+        /// <summary>
+        /// Sets how many sessions the SSL driver keeps for resumption, shared by all streams: client
+        /// sessions are looked up by target host, server sessions by the session ID the client offers.
+        /// A size of 0 turns resumption off for that side. Sessions already cached are dropped.
+        /// </summary>
+        public static void SetSessionCacheSize(int clientSessions, int serverSessions)
+        {
+            if (clientSessions < 0 || serverSessions < 0) throw new ArgumentOutOfRangeException();
+
+            if (!SslNative.SetOption(-1, SslNative.c_OptionClientSessionCache, clientSessions) ||
+                !SslNative.SetOption(-1, SslNative.c_OptionServerSessionCache, serverSessions))
+            {
+                throw new NotSupportedException();
+            }
+        }
+
+        /// <summary>
+        /// Size of the buffer that collects small writes into one TLS record, or 0 (the default) to
+        /// send every Write as it comes. Buffered data goes out when the buffer fills, on Flush, before
+        /// a Read and when the stream is closed.
+        /// </summary>
+        public int WriteBufferSize
+        {
+            get
+            {
+                return _writeBuffer == null ? 0 : _writeBuffer.Length;
+            }
+
+            set
+            {
+                if (value < 0) throw new ArgumentOutOfRangeException();
+
+                Flush();
+
+                _writeBuffer = (value == 0) ? null : new byte[value];
+            }
+        }
+
+        /// <summary>
+        /// Whether the SSL driver reads everything the socket has into its record buffer (the default)
+        /// rather than one record header and body at a time. Set it before authenticating; turn it off
+        /// when the socket carries plain data after the TLS session, which read-ahead could consume.
+        /// </summary>
+        public bool ReadAhead
+        {
+            get
+            {
+                return _readAhead;
+            }
+
+            set
+            {
+                if (_sslContext != -1) throw new InvalidOperationException();
+
+                _readAhead = value;
+            }
+        }
+
+        public override void Flush()
+        {
+            if (_writeCount > 0)
+            {
+                int count = _writeCount;
+
+                _writeCount = 0;
+
+                SslNative.SecureWrite(_socket, _writeBuffer, 0, count, _socket.SendTimeout);
+            }
+        }
+
         public override long Length
         {
             get
@@ -138,6 +237,17 @@ namespace Microsoft.SPOT.Net.Security
         {
             if (!_disposed)
             {
+                if (disposing && _socket.m_Handle != -1)
+                {
+                    try
+                    {
+                        Flush();
+                    }
+                    catch
+                    {
+                    }
+                }
+
                 _disposed = true;
 
                 if(_socket.m_Handle != -1)
@@ -176,6 +286,9 @@ namespace Microsoft.SPOT.Net.Security
                 throw new ArgumentOutOfRangeException();
             }
 
+            // the peer may be waiting for what we have buffered before it answers
+            Flush();
+
             return SslNative.SecureRead(_socket, buffer, offset, size, _socket.ReceiveTimeout);
         }
 
@@ -201,6 +314,31 @@ namespace Microsoft.SPOT.Net.Security
                 throw new ArgumentOutOfRangeException();
             }
 
+            if (_writeBuffer != null)
+            {
+                if (_writeCount + size <= _writeBuffer.Length)
+                {
+                    Array.Copy(buffer, offset, _writeBuffer, _writeCount, size);
+
+                    _writeCount += size;
+
+                    if (_writeCount == _writeBuffer.Length) Flush();
+
+                    return;
+                }
+
+                Flush();
+
+                if (size < _writeBuffer.Length)
+                {
+                    Array.Copy(buffer, offset, _writeBuffer, 0, size);
+
+                    _writeCount = size;
+
+                    return;
+                }
+            }
+
             SslNative.SecureWrite(_socket, buffer, offset, size, _socket.SendTimeout);
         }
     }
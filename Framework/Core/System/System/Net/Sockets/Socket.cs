@@ -230,6 +230,53 @@ namespace System.Net.Sockets
             return NativeSocket.send(this, buffer, offset, size, (int)socketFlags, m_sendTimeout);
         }
 
+        public int SendVector(byte[][] buffers, int[] offsets, int[] counts)
+        {
+            if (m_Handle == -1)
+            {
+                throw new ObjectDisposedException();
+            }
+
+            if (buffers == null || offsets == null || counts == null)
+            {
+                throw new ArgumentNullException();
+            }
+
+            if (offsets.Length != buffers.Length || counts.Length != buffers.Length)
+            {
+                throw new ArgumentException();
+            }
+
+            int last = buffers.Length - 1;
+
+            while (last > 0 && counts[last] == 0) last--;
+
+            int sent = 0;
+
+            // every fragment but the last is marked partial, so the stack packs them into as few segments as possible
+            for (int i = 0; i <= last; i++)
+            {
+                SocketFlags flags = (i < last) ? SocketFlags.Partial : SocketFlags.None;
+                int offset = offsets[i];
+                int count = counts[i];
+
+                // a short write leaves the rest of the fragment to send; if nothing goes out at all,
+                // stop and report what was sent so far
+                while (count > 0)
+                {
+                    int written = NativeSocket.send(this, buffers[i], offset, count, (int)flags, m_sendTimeout);
+
+                    if (written <= 0) return sent;
+
+                    sent += written;
+                    offset += written;
+                    count -= written;
+                }
+            }
+
+            return sent;
+        }
+
         public int SendTo(byte[] buffer, int offset, int size, SocketFlags socketFlags, EndPoint remoteEP)
         {
             if (m_Handle == -1)
@@ -71,6 +71,22 @@ namespace System.Collections
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
         public extern virtual int Add(Object value);
 
+        public virtual void AddRange(ICollection c)
+        {
+            ArrayList list = c as ArrayList;
+
+            if (list != null)
+            {
+                AddRange(list._items, 0, list._size);
+            }
+            else
+            {
+                Object[] items = ToObjectArray(c);
+
+                AddRange(items, 0, items.Length);
+            }
+        }
+
         public virtual int BinarySearch(Object value, IComparer comparer)
         {
             return Array.BinarySearch(_items, 0, _size, value, comparer);
@@ -133,6 +149,22 @@ namespace System.Collections
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
         public extern virtual void Insert(int index, Object value);
 
+        public virtual void InsertRange(int index, ICollection c)
+        {
+            ArrayList list = c as ArrayList;
+
+            if (list != null)
+            {
+                InsertRange(index, list._items, 0, list._size);
+            }
+            else
+            {
+                Object[] items = ToObjectArray(c);
+
+                InsertRange(index, items, 0, items.Length);
+            }
+        }
+
         public virtual void Remove(Object obj)
         {
             int index = Array.IndexOf(_items, obj, 0, _size);
@@ -145,6 +177,9 @@ namespace System.Collections
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
         public extern virtual void RemoveAt(int index);
 
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public extern virtual void RemoveRange(int index, int count);
+
         public virtual Object[] ToArray()
         {
             return (Object[])ToArray(typeof(object));
@@ -158,6 +193,29 @@ namespace System.Collections
 
             return array;
         }
+
+        // The native range operations copy straight out of an Object[], so any other collection is flattened first.
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        private extern void AddRange(Object[] items, int start, int count);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        private extern void InsertRange(int index, Object[] items, int start, int count);
+
+        private Object[] ToObjectArray(ICollection c)
+        {
+            if (c == null) throw new ArgumentNullException();
+
+            Object[] items = c as Object[];
+
+            if (items == null)
+            {
+                items = new Object[c.Count];
+
+                c.CopyTo(items, 0);
+            }
+
+            return items;
+        }
     }
 }
 
@@ -23,7 +23,11 @@ namespace System
 
         public String ToString(String format)
         {
-            return Number.Format((int)m_value, true, format, NumberFormatInfo.CurrentInfo);
+            // Hex prints the bits of this type, not of the int it is widened to
+            bool hex   = format != null && format.Length > 0 && (format[0] == 'X' || format[0] == 'x');
+            int  value = hex ? (int)(ushort)m_value : (int)m_value;
+
+            return Number.Format(value, true, format, NumberFormatInfo.CurrentInfo);
         }
 
         public static short Parse(String s)
@@ -283,7 +283,7 @@ namespace System
         {
             char formatCh;
             int precision;
-            ValidateFormat(format, out formatCh, out precision);
+            ValidateFormat(format, isInteger, out formatCh, out precision);
 
             String result = FormatNative(value, formatCh, precision);
 
@@ -300,7 +300,15 @@ namespace System
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
         private static extern String FormatNative(Object value, char format, int precision);
 
-        private static void ValidateFormat(String format, out char formatCh, out int precision)
+        // Parse the UTF-8 bytes of the string natively; a null string parses as 0. A zero max stands for UInt64,
+        // whose range does not fit the signed min/max check.
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern long ParseInteger(String s, bool signed, long min, long max);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern double ParseDouble(String s);
+
+        private static void ValidateFormat(String format, bool isInteger, out char formatCh, out int precision)
         {
             precision = 0;
 
@@ -312,8 +320,8 @@ namespace System
 
             formatCh = format[0];
 
-            // ToUpper, since all the supported format characters are invariant in case
-            if (formatCh >= 'a' && formatCh <= 'z')
+            // ToUpper, since all the supported format characters but 'x' (lower case hex digits) are invariant in case
+            if (formatCh >= 'a' && formatCh <= 'z' && formatCh != 'x')
             {
                 formatCh = (char)(formatCh - ('a' - 'A'));
             }
@@ -352,6 +360,11 @@ namespace System
                 case 'N':
                     if (formatLen == 1) precision = 2; // if no precision is specified, use the default
                     break;
+                case 'D':
+                case 'X':
+                case 'x':
+                    if (!isInteger) throw new ArgumentException(); // integral types only, precision is the minimum number of digits
+                    break;
                 default:
                     throw new ArgumentException();
             }
@@ -371,6 +384,9 @@ namespace System
                     // AppendTrailingZeros, ReplaceNegativeSign
                     result = AppendTrailingZeros(result, precision, info);
                     goto case 'G'; // falls through
+                case 'D':
+                    // Zero padding is done natively, ReplaceNegativeSign
+                    goto case 'G'; // falls through
                 case 'G':
                     result = ReplaceNegativeSign(result, info);
                     break;
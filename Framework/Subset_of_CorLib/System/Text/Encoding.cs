@@ -79,6 +79,16 @@ namespace System.Text
             throw new NotImplementedException();
         }
 
+        public virtual int GetBytes(String s, int charIndex, int charCount, byte[] bytes, int byteIndex)
+        {
+            throw new NotImplementedException();
+        }
+
+        public virtual int GetChars(byte[] bytes, int byteIndex, int byteCount, char[] chars, int charIndex)
+        {
+            throw new NotImplementedException();
+        }
+
         public abstract Decoder GetDecoder();
         public static Encoding UTF8
         {
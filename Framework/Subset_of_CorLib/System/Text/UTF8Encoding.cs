@@ -53,6 +53,12 @@ namespace System.Text
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
         public extern override char[] GetChars(byte[] bytes);
 
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public extern override int GetBytes(String s, int charIndex, int charCount, byte[] bytes, int byteIndex);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public extern override int GetChars(byte[] bytes, int byteIndex, int byteCount, char[] chars, int charIndex);
+
         public override Decoder GetDecoder()
         {
             return new UTF8Decoder();
@@ -202,6 +202,7 @@ namespace Microsoft.SPOT.Emulator.Sockets
         Dictionary<int, SocketData> _sockets = new Dictionary<int, SocketData>();
         int _handleNext;
         const int MaxSockets = 62; //for the call to WaitAny
+        const int SOCKET_WRITE_PARTIAL_OPTION = 0x8000; //SocketFlags.Partial from SendVector, see Sockets_decl.h
         AutoResetEvent _eventSignalThread;
         AutoResetEvent _eventSsl = new AutoResetEvent(false);
         Thread _threadWaitForEvents;
@@ -791,7 +792,8 @@ namespace Microsoft.SPOT.Emulator.Sockets
 
                     Marshal.Copy(buf, data, 0, len);
 
-                    sent = sd.Socket.Send(data, 0, len, (SocketFlags)flags);
+                    // the host stack has no partial stream writes (MSG_PARTIAL is message-oriented), send it right away
+                    sent = sd.Socket.Send(data, 0, len, (SocketFlags)(flags & ~SOCKET_WRITE_PARTIAL_OPTION));
 
                     ClearSocketEvent(socket, false);
 
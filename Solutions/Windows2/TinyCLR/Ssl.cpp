@@ -97,4 +97,15 @@ INT32 SSL_DataAvailable( SOCK_SOCKET socket )
     return EmulatorNative::GetISslDriver()->DataAvailable( socket );
 }
 
+// the emulator's SslStream manages its own session cache and does not report resumption
+BOOL SSL_SetOption( INT32 sslContextHandle, INT32 option, INT32 value )
+{
+    return FALSE;
+}
+
+INT32 SSL_SessionReused( SOCK_SOCKET socket )
+{
+    return SOCK_SOCKET_ERROR;
+}
+
 
@@ -505,6 +505,11 @@ int hal_vsnprintf( char* buffer, size_t len, const char* format, va_list arg )
     return _vsnprintf_s( buffer, len, len-1/* force space for trailing zero*/, format, arg );
 }
 
+double hal_strtod( const char* str, char** endptr )
+{
+    return strtod( str, endptr );
+}
+
 ///////////////////////////////////////////////////////////////
 
 size_t CPU_GetCachableAddress( size_t address )
@@ -171,6 +171,9 @@ void Test_OpenSSL_Crypto()
 
     int retval = 0;
     // run OpenSSL test suite
+    lcd_printf("\nTesting AES...\n");
+    retval = ssl_test_aes(0,NULL);
+    LCD_Clear();
     lcd_printf("\nTesting BF...\n");
     retval = ssl_test_bf(0,NULL); //blowfish
     LCD_Clear();
@@ -260,6 +263,9 @@ void Test_OpenSSL_Crypto()
     LCD_Clear();
     lcd_printf("\nTesting X509v3...\n");
     retval =  ssl_test_x509v3(0,NULL);
+    LCD_Clear();
+    lcd_printf("\nCipher and digest speed...\n");
+    retval =  ssl_test_speed(0,NULL);
 
     LCD_Clear();
     lcd_printf("\nTest Suite for OpenSSL Crypto ibraries completed...\n");    
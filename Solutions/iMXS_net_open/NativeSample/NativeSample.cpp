@@ -13,6 +13,11 @@ HAL_DECLARE_NULL_HEAP();
 
 void ApplicationEntryPoint()
 {
+    // receive throughput of the ENC28J60 driver against the chip model, before the board's own traffic
+    ENC28J60_Simulation enc28j60Test( 1000 );
+
+    enc28j60Test.Execute( STREAM__LCD );
+
     while(true)
     {
         hal_printf("Hello World!\n");
@@ -0,0 +1,469 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "enc28j60_sim.h"
+
+#include "lwip\netif.h"
+#include "lwip\pbuf.h"
+#include "enc28j60_lwip.h"
+
+//--//
+
+//
+// The driver and its configuration are linked from this library in place of
+// the board's enc28j60_lwip driver, so the pieces it expects from there are
+// provided here.  So are the three pbuf calls it makes: a NativeSample links
+// neither lwIP nor a heap, and a receive burst never holds more than
+// ENC28J60_RECV_BURST frames.
+//
+
+ENC28J60_LWIP_DEVICE_CONFIG g_ENC28J60_LWIP_Config =
+{
+    {
+        {                                   // ENC28J60_DRIVER_CONFIG
+            {                               // SPI_CONFIGURATION
+                GPIO_PIN_NONE,
+                FALSE,
+                FALSE,
+                TRUE,
+                FALSE,
+                20000,                      // the fastest clock the ENC28J60 accepts
+                0,
+                0,
+                0,
+            },
+
+            GPIO_PIN_NONE,                  // Interrupt Pin
+        },
+    }
+};
+
+static BOOL s_continuationQueued;
+
+void lwip_interrupt_continuation( )
+{
+    s_continuationQueued = TRUE;
+}
+
+struct ENC28J60_Simulation_PBuf
+{
+    struct pbuf Header;
+    BOOL        InUse;
+    UINT32      Data[(ENC28J60_MAXIMUM_FRAME_SIZE + ENC28J60_RECV_HEADER_SIZE + 3) / 4];
+};
+
+static ENC28J60_Simulation_PBuf s_pbufs[ENC28J60_RECV_BURST];
+
+struct pbuf* pbuf_alloc( pbuf_layer layer, u16_t length, pbuf_type type )
+{
+    if(length > sizeof(s_pbufs[0].Data)) return NULL;
+
+    for(UINT32 i = 0; i < ARRAYSIZE(s_pbufs); i++)
+    {
+        if(!s_pbufs[i].InUse)
+        {
+            struct pbuf* p = &s_pbufs[i].Header;
+
+            s_pbufs[i].InUse = TRUE;
+
+            memset( p, 0, sizeof(*p) );
+            p->payload = s_pbufs[i].Data;
+            p->tot_len = length;
+            p->len     = length;
+            p->type    = type;
+            p->ref     = 1;
+
+            return p;
+        }
+    }
+
+    return NULL;
+}
+
+void pbuf_realloc( struct pbuf* p, u16_t new_len )
+{
+    if(new_len < p->tot_len)
+    {
+        p->tot_len = new_len;
+        p->len     = new_len;
+    }
+}
+
+u8_t pbuf_free( struct pbuf* p )
+{
+    for(UINT32 i = 0; i < ARRAYSIZE(s_pbufs); i++)
+    {
+        if(p == &s_pbufs[i].Header)
+        {
+            s_pbufs[i].InUse = FALSE;
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+//--//
+
+//
+// Chip model: the control registers, the 8KB buffer memory and the receive
+// ring as the MAC fills it.  Only what the driver touches is modelled.
+//
+
+static const UINT32 c_BufferSize                = 0x2000;
+static const UINT32 c_RingSize                  = ENC28J60_RECEIVE_BUFFER_END - ENC28J60_RECEIVE_BUFFER_START + 1;
+static const UINT32 c_TransactionOverhead_uSecs = 2;        // chip select and SPI driver entry per transaction
+
+struct ENC28J60_Model
+{
+    UINT8   Banks[4][0x1B];
+    UINT8   Common[5];                                      // EIE, EIR, ESTAT, ECON2, ECON1 are in every bank
+    UINT16  Phy[0x20];
+    UINT8   Memory[c_BufferSize];
+    UINT16  WritePointer;                                   // ERXWRPT, where the MAC puts the next frame
+    UINT8   PacketCount;                                    // EPKTCNT
+
+    UINT32  Transactions;
+    UINT32  Bytes;
+    UINT32  Dropped;
+};
+
+static ENC28J60_Model s_model;
+
+static UINT8& ENC28J60_Model_Register( UINT8 address )
+{
+    if(address >= ENC28J60_EIE)
+    {
+        return s_model.Common[address - ENC28J60_EIE];
+    }
+
+    return s_model.Banks[s_model.Common[ENC28J60_ECON1 - ENC28J60_EIE] & 0x3][address];
+}
+
+static UINT16 ENC28J60_Model_Pointer( UINT8 addressLow )
+{
+    return s_model.Banks[0][addressLow] | (s_model.Banks[0][addressLow + 1] << 8);
+}
+
+static void ENC28J60_Model_SetPointer( UINT8 addressLow, UINT16 value )
+{
+    s_model.Banks[0][addressLow    ] = value & 0xFF;
+    s_model.Banks[0][addressLow + 1] = value >> 8;
+}
+
+static BOOL ENC28J60_Model_IsMacRegister( UINT8 address )
+{
+    UINT8 bank = s_model.Common[ENC28J60_ECON1 - ENC28J60_EIE] & 0x3;
+
+    // MAC and MII registers answer a read with a dummy byte first
+    return (address < ENC28J60_EIE) && ((bank == 2) || (bank == 3 && (address <= 0x05 || address == ENC28J60_MISTAT)));
+}
+
+static UINT8 ENC28J60_Model_Read( UINT8 address )
+{
+    UINT8 bank = s_model.Common[ENC28J60_ECON1 - ENC28J60_EIE] & 0x3;
+
+    if(bank == 0 && address == ENC28J60_ERXWRPTL) return s_model.WritePointer & 0xFF;
+    if(bank == 0 && address == ENC28J60_ERXWRPTH) return s_model.WritePointer >> 8;
+    if(bank == 1 && address == ENC28J60_EPKTCNT ) return s_model.PacketCount;
+
+    return ENC28J60_Model_Register( address );
+}
+
+static void ENC28J60_Model_Written( UINT8 address )
+{
+    UINT8  bank = s_model.Common[ENC28J60_ECON1 - ENC28J60_EIE] & 0x3;
+    UINT8& reg  = ENC28J60_Model_Register( address );
+
+    if(address == ENC28J60_ECON2 && (reg & (1 << ENC28J60_ECON2_PKTDEC_BIT)))
+    {
+        reg &= ~(1 << ENC28J60_ECON2_PKTDEC_BIT);
+
+        if(s_model.PacketCount) s_model.PacketCount--;
+    }
+    else if(bank == 0 && (address == ENC28J60_ERXSTL || address == ENC28J60_ERXSTH))
+    {
+        s_model.WritePointer = ENC28J60_Model_Pointer( ENC28J60_ERXSTL );
+    }
+    else if(bank == 2 && address == ENC28J60_MICMD && (reg & (1 << ENC28J60_MICMD_MIIRD_BIT)))
+    {
+        UINT16 value = s_model.Phy[s_model.Banks[2][ENC28J60_MIREGADR] & 0x1F];
+
+        s_model.Banks[2][ENC28J60_MIRDL] = value & 0xFF;
+        s_model.Banks[2][ENC28J60_MIRDH] = value >> 8;
+    }
+    else if(bank == 2 && address == ENC28J60_MIWRH)
+    {
+        s_model.Phy[s_model.Banks[2][ENC28J60_MIREGADR] & 0x1F] = s_model.Banks[2][ENC28J60_MIWRL] | (reg << 8);
+    }
+}
+
+static void ENC28J60_Model_Reset()
+{
+    memset( &s_model, 0, sizeof(s_model) );
+
+    s_model.Common[ENC28J60_ECON2 - ENC28J60_EIE] = (1 << ENC28J60_ECON2_AUTOINC_BIT);
+    s_model.Common[ENC28J60_ESTAT - ENC28J60_EIE] = 0x01;   // CLKRDY
+
+    s_model.Phy[ENC28J60_PHID1] = ENC28J60_PHYID1;
+    s_model.Phy[ENC28J60_PHID2] = ENC28J60_PHYID2;
+}
+
+//
+// The MAC side: store one received frame (size includes the CRC) the way the
+// chip does, behind a next packet pointer and receive status vector, or drop
+// it if the ring is full.
+//
+static BOOL ENC28J60_Model_Fits( UINT16 size )
+{
+    UINT16 readPtr = ENC28J60_Model_Pointer( ENC28J60_ERXRDPTL );
+    UINT32 needed  = (ENC28J60_RECV_HEADER_SIZE + size + 1) & ~1;
+    UINT32 free;
+
+    free = (readPtr >= s_model.WritePointer) ? readPtr - s_model.WritePointer : readPtr + c_RingSize - s_model.WritePointer;
+
+    return (needed < free) && (s_model.PacketCount < 0xFF);
+}
+
+static BOOL ENC28J60_Model_Receive( UINT16 size, UINT16 sequence )
+{
+    UINT16 start    = ENC28J60_Model_Pointer( ENC28J60_ERXSTL );
+    UINT16 end      = ENC28J60_Model_Pointer( ENC28J60_ERXNDL );
+    UINT32 needed   = (ENC28J60_RECV_HEADER_SIZE + size + 1) & ~1;
+    UINT16 next;
+    UINT16 address;
+    UINT8  header[ENC28J60_RECV_HEADER_SIZE];
+
+    if(!ENC28J60_Model_Fits( size ))
+    {
+        s_model.Common[ENC28J60_EIR - ENC28J60_EIE] |= (1 << ENC28J60_EIR_RXERIF_BIT);
+        s_model.Dropped++;
+        return FALSE;
+    }
+
+    next = s_model.WritePointer + needed;
+    if(next > end) next -= c_RingSize;
+
+    header[0] = next & 0xFF;
+    header[1] = next >> 8;
+    header[2] = size & 0xFF;
+    header[3] = size >> 8;
+    header[4] = 0x80;                                       // received ok
+    header[5] = 0;
+
+    address = s_model.WritePointer;
+
+    for(UINT32 i = 0; i < ENC28J60_RECV_HEADER_SIZE + size; i++)
+    {
+        UINT32 frameOffset = i - ENC28J60_RECV_HEADER_SIZE;
+
+        if     (i < ENC28J60_RECV_HEADER_SIZE) s_model.Memory[address] = header[i];
+        else if(frameOffset == 0             ) s_model.Memory[address] = sequence & 0xFF;
+        else if(frameOffset == 1             ) s_model.Memory[address] = sequence >> 8;
+        else                                   s_model.Memory[address] = (UINT8)(sequence + frameOffset);
+
+        address = (address == end) ? start : address + 1;
+    }
+
+    s_model.WritePointer = next;
+    s_model.PacketCount++;
+    s_model.Common[ENC28J60_EIR   - ENC28J60_EIE] |= (1 << ENC28J60_EIR_PKTIF_BIT);
+    s_model.Common[ENC28J60_ESTAT - ENC28J60_EIE] |= (1 << ENC28J60_ESTAT_INT);
+
+    return TRUE;
+}
+
+//
+// The SPI side, with the CPU_SPI_nWrite8_nRead8 contract: the transaction is
+// max(WriteCount, ReadCount + ReadStartOffset) bytes long, the last byte written
+// is repeated, and received bytes from ReadStartOffset on are stored in Read8.
+//
+BOOL ENC28J60_Simulator_nWrite8_nRead8( const SPI_CONFIGURATION& Configuration, UINT8* Write8, INT32 WriteCount, UINT8* Read8, INT32 ReadCount, INT32 ReadStartOffset )
+{
+    INT32 total   = ReadCount ? ReadCount + ReadStartOffset : 0;
+    UINT8 opcode  = Write8[0] >> 5;
+    UINT8 address = Write8[0] & 0x1F;
+
+    if(total < WriteCount) total = WriteCount;
+
+    s_model.Transactions++;
+    s_model.Bytes += total;
+
+    if(opcode == ENC28J60_SPI_SYSTEM_COMMAND_SOFT_RESET_OPCODE)
+    {
+        ENC28J60_Model_Reset();
+        return TRUE;
+    }
+
+    for(INT32 i = 1; i < total; i++)
+    {
+        UINT8  mosi = Write8[i < WriteCount ? i : WriteCount - 1];
+        UINT8  miso = 0;
+        UINT16 ptr;
+
+        switch(opcode)
+        {
+        case ENC28J60_SPI_READ_CONTROL_REGISTER_OPCODE:
+            if(i > 1 || !ENC28J60_Model_IsMacRegister( address ))
+            {
+                miso = ENC28J60_Model_Read( address );
+            }
+            break;
+
+        case ENC28J60_SPI_READ_BUFFER_MEMORY_OPCODE:
+            ptr  = ENC28J60_Model_Pointer( ENC28J60_ERDPTL );
+            miso = s_model.Memory[ptr % c_BufferSize];
+
+            if(s_model.Common[ENC28J60_ECON2 - ENC28J60_EIE] & (1 << ENC28J60_ECON2_AUTOINC_BIT))
+            {
+                // reads wrap from the end of the receive ring back to its start
+                ptr = (ptr == ENC28J60_Model_Pointer( ENC28J60_ERXNDL )) ? ENC28J60_Model_Pointer( ENC28J60_ERXSTL ) : ptr + 1;
+
+                ENC28J60_Model_SetPointer( ENC28J60_ERDPTL, ptr );
+            }
+            break;
+
+        case ENC28J60_SPI_WRITE_CONTROL_REGISTER_OPCODE:
+            if(i == 1)
+            {
+                ENC28J60_Model_Register( address ) = mosi;
+                ENC28J60_Model_Written( address );
+            }
+            break;
+
+        case ENC28J60_SPI_WRITE_BUFFER_MEMORY_OPCODE:
+            ptr = ENC28J60_Model_Pointer( ENC28J60_EWRPTL );
+            s_model.Memory[ptr % c_BufferSize] = mosi;
+            ENC28J60_Model_SetPointer( ENC28J60_EWRPTL, ptr + 1 );
+            break;
+
+        case ENC28J60_SPI_BIT_FIELD_SET_OPCODE:
+            if(i == 1)
+            {
+                ENC28J60_Model_Register( address ) |= mosi;
+                ENC28J60_Model_Written( address );
+            }
+            break;
+
+        case ENC28J60_SPI_BIT_FIELD_CLEAR_OPCODE:
+            if(i == 1)
+            {
+                ENC28J60_Model_Register( address ) &= ~mosi;
+            }
+            break;
+        }
+
+        if(Read8 != NULL && i >= ReadStartOffset && i < ReadStartOffset + ReadCount)
+        {
+            Read8[i - ReadStartOffset] = miso;
+        }
+    }
+
+    return TRUE;
+}
+
+//--//
+
+static UINT32 s_framesDelivered;
+static UINT32 s_framesBad;
+static UINT16 s_expectedLength;
+
+static err_t ENC28J60_Simulation_Input( struct pbuf* p, struct netif* inp )
+{
+    UINT8* data = (UINT8*)p->payload;
+
+    if(p->tot_len != s_expectedLength || p->len != p->tot_len || data[2] != (UINT8)(data[0] + 2))
+    {
+        s_framesBad++;
+    }
+
+    s_framesDelivered++;
+
+    pbuf_free( p );
+
+    return ERR_OK;
+}
+
+ENC28J60_Simulation::ENC28J60_Simulation( UINT32 FramesPerSize )
+{
+    m_framesPerSize = FramesPerSize;
+}
+
+BOOL ENC28J60_Simulation::Execute( LOG_STREAM Stream )
+{
+    static const UINT16 c_FrameSizes[] = { 64, 590, 1518 };
+
+    SPI_CONFIGURATION* SpiConf = &g_ENC28J60_LWIP_Config.DeviceConfigs[0].SPI_Config;
+    struct netif       netIf;
+    char               buffer[128];
+    BOOL               result  = TRUE;
+
+    Log& log = Log::InitializeLog( Stream, "ENC28J60_Simulation" );
+
+    memset( &netIf, 0, sizeof(netIf) );
+    netIf.input = ENC28J60_Simulation_Input;
+
+    for(UINT32 size = 0; size < ARRAYSIZE(c_FrameSizes); size++)
+    {
+        UINT32 sequence = 0;
+        UINT64 wire_uSecs;
+        UINT64 framesPerSecond;
+
+        ENC28J60_Model_Reset();
+        enc28j60_lwip_setup_recv_buffer( &netIf, SpiConf );
+        memset( &g_ENC28J60_LWIP_RecvStats, 0, sizeof(g_ENC28J60_LWIP_RecvStats) );
+
+        s_framesDelivered = 0;
+        s_framesBad       = 0;
+        s_expectedLength  = c_FrameSizes[size] - 4;
+
+        // setting up the ring is not part of the measurement
+        s_model.Transactions = 0;
+        s_model.Bytes        = 0;
+
+        while(sequence < m_framesPerSize)
+        {
+            // a burst of back to back frames, as many as the ring takes, then one interrupt
+            while(sequence < m_framesPerSize && ENC28J60_Model_Fits( c_FrameSizes[size] ))
+            {
+                ENC28J60_Model_Receive( c_FrameSizes[size], (UINT16)sequence++ );
+            }
+
+            do
+            {
+                s_continuationQueued = FALSE;
+
+                enc28j60_lwip_interrupt( &netIf );
+            }
+            while(s_continuationQueued);
+        }
+
+        wire_uSecs  = (UINT64)s_model.Bytes * 8 * 1000 / SpiConf->Clock_RateKHz;
+        wire_uSecs += (UINT64)s_model.Transactions * (c_TransactionOverhead_uSecs + SpiConf->CS_Setup_uSecs + SpiConf->CS_Hold_uSecs);
+
+        framesPerSecond = (UINT64)s_framesDelivered * 1000000 / (wire_uSecs ? wire_uSecs : 1);
+
+        hal_snprintf( buffer, sizeof(buffer), "%d byte frames: %d.%d transactions/frame, %d frames/s, ring high water %d",
+                      c_FrameSizes[size],
+                      s_model.Transactions / m_framesPerSize, (s_model.Transactions * 10 / m_framesPerSize) % 10,
+                      (UINT32)framesPerSecond,
+                      g_ENC28J60_LWIP_RecvStats.RingHighWater );
+
+        log.Comment( buffer );
+
+        if(s_framesDelivered != m_framesPerSize || s_framesBad != 0 || s_model.Dropped != 0)
+        {
+            hal_snprintf( buffer, sizeof(buffer), "%d delivered, %d corrupt, %d dropped", s_framesDelivered, s_framesBad, s_model.Dropped );
+
+            log.Comment( buffer );
+
+            result = FALSE;
+        }
+    }
+
+    log.CloseLog( result, NULL );
+
+    return result;
+}
+
@@ -0,0 +1,33 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <tinyhal.h>
+#include "..\Log\Log.h"
+
+#ifndef _ENC28J60_SIMULATION_TEST_
+#define _ENC28J60_SIMULATION_TEST_ 1
+
+//
+// Receive throughput of the lwIP ENC28J60 driver against a model of the chip.
+// Build with ENC28J60_LWIP_SPI_SIMULATION defined (see dotNetMF.proj in this
+// directory) so that the driver's SPI traffic reaches the model.  Frames per
+// second are computed from the SPI bytes and transactions the driver needed,
+// at the configured clock, not from the host's own speed.
+//
+
+class ENC28J60_Simulation
+{
+    UINT32   m_framesPerSize;
+
+public:
+
+//--//
+             ENC28J60_Simulation ( UINT32 FramesPerSize );
+
+    BOOL     Execute             ( LOG_STREAM Stream );
+
+};
+
+#endif
+
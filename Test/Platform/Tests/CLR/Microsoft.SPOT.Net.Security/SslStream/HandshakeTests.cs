@@ -0,0 +1,157 @@
+using System;
+using System.Net;
+using System.Net.Sockets;
+using System.Threading;
+using Microsoft.SPOT;
+using Microsoft.SPOT.Net.Security;
+using Microsoft.SPOT.Platform.Test;
+
+
+namespace Microsoft.SPOT.Platform.Tests
+{
+    class HandshakeTests : IMFTestInterface
+    {
+        const int c_Handshakes = 5;
+
+        SslServer m_server;
+        SslClient m_client;
+
+        [SetUp]
+        public InitializeResult Initialize()
+        {
+            Log.Comment("Full versus resumed TLS handshakes between a client and a server on loopback.");
+
+            try
+            {
+                m_server = new SslServer();
+                m_client = new SslClient();
+            }
+            catch (NotSupportedException)
+            {
+                Log.Comment("If this feature throws an exception then it is assumed that it isn't supported on this device type");
+                return InitializeResult.Skip;
+            }
+
+            return InitializeResult.ReadyToGo;
+        }
+
+        [TearDown]
+        public void CleanUp()
+        {
+            m_server.serverSocket.Close();
+        }
+
+        void AcceptHandshakes()
+        {
+            for (int i = 0; i < c_Handshakes; i++)
+            {
+                using (Socket socket = m_server.serverSocket.Accept())
+                {
+                    SslStream ssl = new SslStream(socket);
+
+                    ssl.AuthenticateAsServer(m_server.cert, m_server.ca, m_server.verify, m_server.sslProtocols);
+                    ssl.Close();
+                }
+            }
+        }
+
+        [TestMethod]
+        public MFTestResults Handshake_Resumption()
+        {
+            Thread server  = new Thread(AcceptHandshakes);
+            long   first   = 0;
+            long   resumed = 0;
+            long   fastest = long.MaxValue;
+            int    reused  = 0;
+            bool   known   = true;
+
+            try
+            {
+                // start from empty caches, earlier tests may have left a session for this host
+                SslStream.SetSessionCacheSize(4, 8);
+            }
+            catch (NotSupportedException)
+            {
+            }
+
+            server.Start();
+
+            try
+            {
+                for (int i = 0; i < c_Handshakes; i++)
+                {
+                    Socket socket = new Socket(AddressFamily.InterNetwork, SocketType.Stream, ProtocolType.Tcp);
+
+                    socket.Connect(m_server.serverEp);
+
+                    SslStream ssl   = new SslStream(socket);
+                    long      start = DateTime.Now.Ticks;
+
+                    // the first handshake is a full one, later ones to the same host can resume its session
+                    ssl.AuthenticateAsClient(m_client.targetHost, m_client.cert, m_client.ca, m_client.verify, m_client.sslProtocols);
+
+                    long usec = (DateTime.Now.Ticks - start) / 10;
+
+                    if (i == 0)
+                    {
+                        first = usec;
+                    }
+                    else
+                    {
+                        resumed += usec;
+
+                        if (usec < fastest) fastest = usec;
+                    }
+
+                    if (known)
+                    {
+                        try
+                        {
+                            if (ssl.IsSessionReused)
+                            {
+                                if (i == 0)
+                                {
+                                    Log.Comment("The first handshake cannot resume a session");
+                                    return MFTestResults.Fail;
+                                }
+
+                                reused++;
+                            }
+                        }
+                        catch (NotSupportedException)
+                        {
+                            known = false;
+                        }
+                    }
+
+                    ssl.Close();
+                }
+            }
+            catch (Exception e)
+            {
+                Log.Comment("Incorrect Exception caught: " + e.ToString());
+                return MFTestResults.Fail;
+            }
+
+            server.Join();
+
+            Log.Comment("First handshake: " + first + " usec");
+            Log.Comment("Following handshakes: " + (resumed / (c_Handshakes - 1)) + " usec each");
+
+            if (known)
+            {
+                Log.Comment("Resumed handshakes: " + reused + " of " + (c_Handshakes - 1));
+
+                if (reused != c_Handshakes - 1) return MFTestResults.Fail;
+            }
+            else if (fastest >= first)
+            {
+                // the driver cannot report resumption, but a resumed handshake skips the key exchange
+                Log.Comment("No handshake was faster than the first one, the session was not resumed");
+                return MFTestResults.Fail;
+            }
+
+            return MFTestResults.Pass;
+        }
+    }
+}
@@ -21,6 +21,8 @@ namespace Microsoft.SPOT.Platform.Tests
                 "X509CertificateTests",
                 "SslStreamTests",
                 "CertificateStoreTests", 
+                "HandshakeTests",
+                "WriteCoalescingTests",
             };
 
             MFTestRunner runner = new MFTestRunner(args);
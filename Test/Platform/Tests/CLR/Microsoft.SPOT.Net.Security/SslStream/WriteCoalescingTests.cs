@@ -0,0 +1,168 @@
+using System;
+using System.Net;
+using System.Net.Sockets;
+using System.Text;
+using System.Threading;
+using Microsoft.SPOT;
+using Microsoft.SPOT.Net.Security;
+using Microsoft.SPOT.Platform.Test;
+
+
+namespace Microsoft.SPOT.Platform.Tests
+{
+    class WriteCoalescingTests : IMFTestInterface
+    {
+        const int c_Messages = 20;
+
+        static readonly byte[] s_line = Encoding.UTF8.GetBytes("X-Header: 0123456789\r\n");
+        const int c_LinesPerMessage = 16;
+
+        SslServer m_server;
+        SslClient m_client;
+        bool      m_serverReadAhead = true;
+
+        [SetUp]
+        public InitializeResult Initialize()
+        {
+            Log.Comment("Header-style small writes over TLS on loopback, with and without SslStream.WriteBufferSize.");
+
+            try
+            {
+                m_server = new SslServer();
+                m_client = new SslClient();
+            }
+            catch (NotSupportedException)
+            {
+                Log.Comment("If this feature throws an exception then it is assumed that it isn't supported on this device type");
+                return InitializeResult.Skip;
+            }
+
+            return InitializeResult.ReadyToGo;
+        }
+
+        [TearDown]
+        public void CleanUp()
+        {
+            m_server.serverSocket.Close();
+        }
+
+        // Reads every message completely, then answers with one byte.
+        void Serve()
+        {
+            using (Socket socket = m_server.serverSocket.Accept())
+            {
+                SslStream ssl    = new SslStream(socket);
+                byte[]    buffer = new byte[s_line.Length * c_LinesPerMessage];
+
+                ssl.ReadAhead = m_serverReadAhead;
+
+                ssl.AuthenticateAsServer(m_server.cert, m_server.ca, m_server.verify, m_server.sslProtocols);
+
+                for (int i = 0; i < c_Messages; i++)
+                {
+                    int received = 0;
+
+                    while (received < buffer.Length)
+                    {
+                        int read = ssl.Read(buffer, received, buffer.Length - received);
+
+                        if (read <= 0) break;
+
+                        received += read;
+                    }
+
+                    ssl.Write(buffer, 0, 1);
+                }
+
+                ssl.Close();
+            }
+        }
+
+        long Run(int writeBufferSize)
+        {
+            Thread server = new Thread(Serve);
+
+            server.Start();
+
+            Socket socket = new Socket(AddressFamily.InterNetwork, SocketType.Stream, ProtocolType.Tcp);
+
+            socket.Connect(m_server.serverEp);
+
+            SslStream ssl   = new SslStream(socket);
+            byte[]    reply = new byte[1];
+
+            ssl.AuthenticateAsClient(m_client.targetHost, m_client.cert, m_client.ca, m_client.verify, m_client.sslProtocols);
+
+            ssl.WriteBufferSize = writeBufferSize;
+
+            long start = DateTime.Now.Ticks;
+
+            for (int i = 0; i < c_Messages; i++)
+            {
+                for (int line = 0; line < c_LinesPerMessage; line++)
+                {
+                    ssl.Write(s_line, 0, s_line.Length);
+                }
+
+                // the read sends whatever is still buffered
+                ssl.Read(reply, 0, 1);
+            }
+
+            long usec = (DateTime.Now.Ticks - start) / 10;
+
+            ssl.Close();
+
+            server.Join();
+
+            return usec / c_Messages;
+        }
+
+        [TestMethod]
+        public MFTestResults WriteCoalescing_HeaderLines()
+        {
+            try
+            {
+                long unbuffered = Run(0);
+                long buffered   = Run(1024);
+
+                Log.Comment(c_LinesPerMessage + " writes per message, unbuffered: " + unbuffered + " usec per message");
+                Log.Comment(c_LinesPerMessage + " writes per message, 1024 byte write buffer: " + buffered + " usec per message");
+            }
+            catch (Exception e)
+            {
+                Log.Comment("Incorrect Exception caught: " + e.ToString());
+                return MFTestResults.Fail;
+            }
+
+            return MFTestResults.Pass;
+        }
+
+        [TestMethod]
+        public MFTestResults ReadAhead_HeaderLines()
+        {
+            try
+            {
+                // the server reads every message in full either way, one record per socket read without read-ahead
+                m_serverReadAhead = false;
+
+                long recordReads = Run(0);
+
+                m_serverReadAhead = true;
+
+                long readAhead = Run(0);
+
+                Log.Comment("Server without read-ahead: " + recordReads + " usec per message");
+                Log.Comment("Server with read-ahead: " + readAhead + " usec per message");
+            }
+            catch (Exception e)
+            {
+                m_serverReadAhead = true;
+
+                Log.Comment("Incorrect Exception caught: " + e.ToString());
+                return MFTestResults.Fail;
+            }
+
+            return MFTestResults.Pass;
+        }
+    }
+}
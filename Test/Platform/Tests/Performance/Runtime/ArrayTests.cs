@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+using System;
+using Microsoft.SPOT.Platform.Test;
+
+namespace Microsoft.SPOT.Platform.Tests
+{
+    public class ArrayTests : IMFTestInterface
+    {
+        const int c_Length     = 4096;
+        const int c_Iterations = 200;
+
+        [SetUp]
+        public InitializeResult Initialize()
+        {
+            Log.Comment("Array.Copy, Array.IndexOf and Array.Clear throughput on byte, int and object arrays.");
+
+            return InitializeResult.ReadyToGo;
+        }
+
+        [TearDown]
+        public void CleanUp()
+        {
+        }
+
+        static void Report(string name, int bytesPerIteration, long start, long stop)
+        {
+            long usec = (stop - start) / 10;
+
+            if(usec == 0) usec = 1;
+
+            Log.Comment(name + ": " + c_Iterations + " iterations, " + usec + " usec, " + ((long)c_Iterations * bytesPerIteration / usec) + " MB/s (approx.)");
+        }
+
+        [TestMethod]
+        public MFTestResults Array_ByteBuffer()
+        {
+            byte[] src = new byte[c_Length];
+            byte[] dst = new byte[c_Length];
+
+            for(int i = 0; i < c_Length; i++) src[i] = (byte)(i % 251);
+
+            src[c_Length - 1] = 255;
+
+            long start = DateTime.Now.Ticks;
+            int  found = 0;
+
+            for(int i = 0; i < c_Iterations; i++)
+            {
+                Array.Copy(src, 0, dst, 0, c_Length);
+
+                found += Array.IndexOf(dst, (byte)255);
+
+                Array.Clear(dst, 0, c_Length);
+            }
+
+            long stop = DateTime.Now.Ticks;
+
+            Report("Byte buffer", c_Length * 3, start, stop);
+
+            return found == c_Iterations * (c_Length - 1) ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults Array_IntArray()
+        {
+            int[] src = new int[c_Length];
+            int[] dst = new int[c_Length];
+
+            for(int i = 0; i < c_Length; i++) src[i] = i;
+
+            long start = DateTime.Now.Ticks;
+            int  found = 0;
+
+            for(int i = 0; i < c_Iterations; i++)
+            {
+                Array.Copy(src, 0, dst, 0, c_Length);
+
+                found += Array.IndexOf(dst, c_Length - 1);
+                found += Array.LastIndexOf(dst, 0);
+
+                //
+                // Overlapping copy within the same array.
+                //
+                Array.Copy(dst, 0, dst, 1, c_Length - 1);
+            }
+
+            long stop = DateTime.Now.Ticks;
+
+            Report("Int array", c_Length * 4 * 4, start, stop);
+
+            return found == c_Iterations * (c_Length - 1) && dst[1] == 0 && dst[c_Length - 1] == c_Length - 2 ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults Array_StringToObject()
+        {
+            string[] src = new string[c_Length / 4];
+            object[] dst = new object[c_Length / 4];
+
+            for(int i = 0; i < src.Length; i++) src[i] = (i % 2 == 0) ? "even" : "odd";
+
+            long start = DateTime.Now.Ticks;
+
+            for(int i = 0; i < c_Iterations; i++)
+            {
+                Array.Copy(src, 0, dst, 0, src.Length);
+            }
+
+            long stop = DateTime.Now.Ticks;
+
+            Report("String[] to object[]", src.Length * 4, start, stop);
+
+            return (string)dst[0] == "even" && (string)dst[dst.Length - 1] == "odd" ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+    }
+}
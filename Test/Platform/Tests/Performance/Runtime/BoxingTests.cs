@@ -0,0 +1,111 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+using System;
+using System.Collections;
+using Microsoft.SPOT.Platform.Test;
+
+namespace Microsoft.SPOT.Platform.Tests
+{
+    public class BoxingTests : IMFTestInterface
+    {
+        const int c_Items = 2000;
+
+        [SetUp]
+        public InitializeResult Initialize()
+        {
+            Log.Comment("Time and heap used when collections box small ints, bools and chars.");
+
+            return InitializeResult.ReadyToGo;
+        }
+
+        [TearDown]
+        public void CleanUp()
+        {
+        }
+
+        static void Report(string name, long start, long stop, uint freeBefore, uint freeAfter)
+        {
+            long usec = (stop - start) / 10;
+
+            Log.Comment(name + ": " + c_Items + " items, " + usec + " usec, " + ((int)freeBefore - (int)freeAfter) + " bytes of heap used");
+        }
+
+        [TestMethod]
+        public MFTestResults Boxing_ArrayList()
+        {
+            ArrayList list = new ArrayList();
+
+            uint freeBefore = Microsoft.SPOT.Debug.GC(true);
+            long start      = DateTime.Now.Ticks;
+
+            for(int i = 0; i < c_Items; i++)
+            {
+                list.Add(i % 100);
+                list.Add((i & 1) == 0);
+                list.Add((char)('a' + i % 26));
+            }
+
+            long stop      = DateTime.Now.Ticks;
+            uint freeAfter = Microsoft.SPOT.Debug.GC(true);
+
+            Report("ArrayList", start, stop, freeBefore, freeAfter);
+
+            int sum = 0;
+
+            for(int i = 0; i < list.Count; i += 3)
+            {
+                sum += (int)list[i];
+
+                if((bool)list[i + 1] != ((i / 3 & 1) == 0)) return MFTestResults.Fail;
+                if((char)list[i + 2] != (char)('a' + (i / 3) % 26)) return MFTestResults.Fail;
+            }
+
+            int expected = 0;
+
+            for(int i = 0; i < c_Items; i++) expected += i % 100;
+
+            return sum == expected ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults Boxing_Hashtable()
+        {
+            Hashtable table = new Hashtable();
+
+            uint freeBefore = Microsoft.SPOT.Debug.GC(true);
+            long start      = DateTime.Now.Ticks;
+
+            for(int i = 0; i < c_Items; i++)
+            {
+                table[i] = (i % 2) == 0;
+            }
+
+            long stop      = DateTime.Now.Ticks;
+            uint freeAfter = Microsoft.SPOT.Debug.GC(true);
+
+            Report("Hashtable", start, stop, freeBefore, freeAfter);
+
+            for(int i = 0; i < c_Items; i += 7)
+            {
+                if((bool)table[i] != ((i % 2) == 0)) return MFTestResults.Fail;
+            }
+
+            return table.Count == c_Items ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults Boxing_Identity()
+        {
+            //
+            // Equal values still compare equal, whether or not they share a box.
+            //
+            object a = 42;
+            object b = 42;
+            object c = 100000;
+            object d = 100000;
+
+            return a.Equals(b) && c.Equals(d) && (int)a == 42 && (int)d == 100000 ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+    }
+}
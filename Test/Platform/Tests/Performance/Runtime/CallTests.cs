@@ -0,0 +1,104 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+using System;
+using Microsoft.SPOT.Platform.Test;
+
+namespace Microsoft.SPOT.Platform.Tests
+{
+    public class CallTests : IMFTestInterface
+    {
+        const int c_Fibonacci  = 20;
+        const int c_SmallCalls = 100000;
+
+        [SetUp]
+        public InitializeResult Initialize()
+        {
+            Log.Comment("Method call overhead.");
+
+            return InitializeResult.ReadyToGo;
+        }
+
+        [TearDown]
+        public void CleanUp()
+        {
+        }
+
+        static int Fibonacci(int n)
+        {
+            return n < 2 ? n : Fibonacci(n - 1) + Fibonacci(n - 2);
+        }
+
+        static int Add(int a, int b)
+        {
+            return a + b;
+        }
+
+        static int AddWithLocals(int a, int b)
+        {
+            int    sum   = a + b;
+            long   wide  = sum;
+            object boxed = null;
+
+            return boxed == null ? (int)wide : 0;
+        }
+
+        static void Report(string name, int calls, long start, long stop)
+        {
+            long usec = (stop - start) / 10;
+
+            Log.Comment(name + ": " + calls + " calls, " + usec + " usec, " + (usec * 1000 / calls) + " nsec per call");
+        }
+
+        [TestMethod]
+        public MFTestResults Call_Fibonacci()
+        {
+            long start  = DateTime.Now.Ticks;
+            int  result = Fibonacci(c_Fibonacci);
+            long stop   = DateTime.Now.Ticks;
+
+            //
+            // Fibonacci(n) makes 2 * Fibonacci(n + 1) - 1 calls.
+            //
+            Report("Fibonacci(" + c_Fibonacci + ")", 2 * Fibonacci(c_Fibonacci + 1) - 1, start, stop);
+
+            return result == 6765 ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults Call_SmallMethod()
+        {
+            int  sum   = 0;
+            long start = DateTime.Now.Ticks;
+
+            for(int i = 0; i < c_SmallCalls; i++)
+            {
+                sum = Add(sum, 1);
+            }
+
+            long stop = DateTime.Now.Ticks;
+
+            Report("Add", c_SmallCalls, start, stop);
+
+            return sum == c_SmallCalls ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults Call_SmallMethodWithLocals()
+        {
+            int  sum   = 0;
+            long start = DateTime.Now.Ticks;
+
+            for(int i = 0; i < c_SmallCalls; i++)
+            {
+                sum = AddWithLocals(sum, 1);
+            }
+
+            long stop = DateTime.Now.Ticks;
+
+            Report("AddWithLocals", c_SmallCalls, start, stop);
+
+            return sum == c_SmallCalls ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+    }
+}
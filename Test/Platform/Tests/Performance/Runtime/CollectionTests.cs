@@ -0,0 +1,179 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+using System;
+using System.Collections;
+using Microsoft.SPOT.Platform.Test;
+
+namespace Microsoft.SPOT.Platform.Tests
+{
+    public class CollectionTests : IMFTestInterface
+    {
+        const int c_Items = 2000;
+
+        [SetUp]
+        public InitializeResult Initialize()
+        {
+            Log.Comment("Growth and shifting cost of ArrayList, Queue and Stack.");
+
+            return InitializeResult.ReadyToGo;
+        }
+
+        [TearDown]
+        public void CleanUp()
+        {
+        }
+
+        static void Report(string name, long start, long stop)
+        {
+            Log.Comment(name + ": " + c_Items + " items, " + ((stop - start) / 10) + " usec");
+        }
+
+        [TestMethod]
+        public MFTestResults ArrayList_AddGrowth()
+        {
+            ArrayList list  = new ArrayList();
+            object    item  = new object();
+            long      start = DateTime.Now.Ticks;
+
+            for(int i = 0; i < c_Items; i++)
+            {
+                list.Add(item);
+            }
+
+            long stop = DateTime.Now.Ticks;
+
+            Report("ArrayList.Add", start, stop);
+
+            return list.Count == c_Items && list.Capacity >= c_Items ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults ArrayList_InsertAndRemoveAtFront()
+        {
+            ArrayList list  = new ArrayList();
+            long      start = DateTime.Now.Ticks;
+
+            for(int i = 0; i < c_Items; i++)
+            {
+                list.Insert(0, i);
+            }
+
+            long mid = DateTime.Now.Ticks;
+
+            Report("ArrayList.Insert(0)", start, mid);
+
+            bool ok = (int)list[0] == c_Items - 1 && (int)list[c_Items - 1] == 0;
+
+            while(list.Count > 0)
+            {
+                list.RemoveAt(0);
+            }
+
+            long stop = DateTime.Now.Ticks;
+
+            Report("ArrayList.RemoveAt(0)", mid, stop);
+
+            return ok ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults ArrayList_Ranges()
+        {
+            ArrayList list  = new ArrayList();
+            object[]  chunk = new object[c_Items / 10];
+
+            for(int i = 0; i < chunk.Length; i++)
+            {
+                chunk[i] = i;
+            }
+
+            long start = DateTime.Now.Ticks;
+
+            for(int i = 0; i < 5; i++)
+            {
+                list.AddRange(chunk);
+                list.InsertRange(0, chunk);
+            }
+
+            long mid = DateTime.Now.Ticks;
+
+            Report("ArrayList.AddRange/InsertRange", start, mid);
+
+            bool ok = list.Count == c_Items && (int)list[0] == 0 && (int)list[c_Items - 1] == chunk.Length - 1;
+
+            //
+            // Inserting a list into itself must see the items as they were before the call.
+            //
+            list.InsertRange(1, list);
+
+            ok = ok && list.Count == 2 * c_Items && (int)list[1] == 0 && (int)list[c_Items] == chunk.Length - 1 && (int)list[c_Items + 1] == 1;
+
+            mid = DateTime.Now.Ticks;
+
+            while(list.Count > 0)
+            {
+                list.RemoveRange(0, list.Count < chunk.Length ? list.Count : chunk.Length);
+            }
+
+            long stop = DateTime.Now.Ticks;
+
+            Report("ArrayList.RemoveRange", mid, stop);
+
+            return ok ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults Queue_EnqueueDequeue()
+        {
+            Queue queue = new Queue();
+            long  start = DateTime.Now.Ticks;
+
+            for(int i = 0; i < c_Items; i++)
+            {
+                queue.Enqueue(i);
+
+                //
+                // Keep the ring wrapped while it grows.
+                //
+                if((i % 3) == 2) queue.Dequeue();
+            }
+
+            long stop = DateTime.Now.Ticks;
+
+            Report("Queue", start, stop);
+
+            int expected = c_Items / 3;
+
+            while(queue.Count > 0)
+            {
+                if((int)queue.Dequeue() != expected++) return MFTestResults.Fail;
+            }
+
+            return expected == c_Items ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults Stack_PushPop()
+        {
+            Stack stack = new Stack();
+            long  start = DateTime.Now.Ticks;
+
+            for(int i = 0; i < c_Items; i++)
+            {
+                stack.Push(i);
+            }
+
+            long stop = DateTime.Now.Ticks;
+
+            Report("Stack", start, stop);
+
+            for(int i = c_Items - 1; i >= 0; i--)
+            {
+                if((int)stack.Pop() != i) return MFTestResults.Fail;
+            }
+
+            return MFTestResults.Pass;
+        }
+    }
+}
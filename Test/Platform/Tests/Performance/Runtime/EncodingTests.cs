@@ -0,0 +1,174 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+using System;
+using System.Text;
+using Microsoft.SPOT.Platform.Test;
+
+namespace Microsoft.SPOT.Platform.Tests
+{
+    public class EncodingTests : IMFTestInterface
+    {
+        const int c_Iterations = 200;
+
+        string m_ascii;
+        string m_mixed;
+
+        [SetUp]
+        public InitializeResult Initialize()
+        {
+            Log.Comment("UTF8Encoding.GetBytes/GetChars and UTF8Decoder.Convert throughput on ASCII and mixed text.");
+
+            m_ascii = "GET /api/v1/sensors/temperature?channel=3&format=json HTTP/1.1\r\nHost: device.local\r\n\r\n";
+            m_mixed = "Temp\u00e9rature: 21.5\u00b0C \u2013 Stra\u00dfe \u65e5\u672c " + m_ascii;
+
+            for(int i = 0; i < 3; i++)
+            {
+                m_ascii += m_ascii;
+                m_mixed += m_mixed;
+            }
+
+            return InitializeResult.ReadyToGo;
+        }
+
+        [TearDown]
+        public void CleanUp()
+        {
+            m_ascii = null;
+            m_mixed = null;
+        }
+
+        static void Report(string name, int bytes, long start, long stop)
+        {
+            long usec = (stop - start) / 10;
+
+            if(usec == 0) usec = 1;
+
+            Log.Comment(name + ": " + c_Iterations + " x " + bytes + " bytes, " + usec + " usec, " + ((long)c_Iterations * bytes / usec) + " MB/s (approx.)");
+        }
+
+        static bool RoundTrip(string name, string text)
+        {
+            byte[] bytes = Encoding.UTF8.GetBytes(text);
+            long   start = DateTime.Now.Ticks;
+
+            for(int i = 0; i < c_Iterations; i++)
+            {
+                Encoding.UTF8.GetBytes(text);
+            }
+
+            long mid = DateTime.Now.Ticks;
+
+            Report(name + " GetBytes", bytes.Length, start, mid);
+
+            char[] chars = null;
+
+            for(int i = 0; i < c_Iterations; i++)
+            {
+                chars = Encoding.UTF8.GetChars(bytes);
+            }
+
+            long stop = DateTime.Now.Ticks;
+
+            Report(name + " GetChars", bytes.Length, mid, stop);
+
+            return new string(chars) == text;
+        }
+
+        [TestMethod]
+        public MFTestResults Encoding_Ascii()
+        {
+            return RoundTrip("ASCII", m_ascii) ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults Encoding_Mixed()
+        {
+            return RoundTrip("Mixed", m_mixed) ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults Encoding_ReusedBuffer()
+        {
+            //
+            // Encoding into and decoding from buffers owned by the caller, at an offset, without allocating per call.
+            //
+            Encoding encoding  = Encoding.UTF8;
+            byte[]   bytes     = new byte[4 + encoding.GetBytes(m_mixed).Length];
+            char[]   chars     = new char[4 + m_mixed.Length + 1];
+            int      byteCount = 0;
+            int      charCount = 0;
+
+            chars[chars.Length - 1] = '#';
+
+            long start = DateTime.Now.Ticks;
+
+            for(int i = 0; i < c_Iterations; i++)
+            {
+                byteCount = encoding.GetBytes(m_mixed, 0, m_mixed.Length, bytes, 4);
+            }
+
+            long mid = DateTime.Now.Ticks;
+
+            Report("Mixed GetBytes(buffer)", byteCount, start, mid);
+
+            for(int i = 0; i < c_Iterations; i++)
+            {
+                charCount = encoding.GetChars(bytes, 4, byteCount, chars, 4);
+            }
+
+            long stop = DateTime.Now.Ticks;
+
+            Report("Mixed GetChars(buffer)", byteCount, mid, stop);
+
+            if(byteCount != bytes.Length - 4 || charCount != m_mixed.Length)
+            {
+                Log.Comment("Unexpected counts: " + byteCount + " bytes, " + charCount + " chars");
+                return MFTestResults.Fail;
+            }
+
+            if(new string(chars, 4, charCount) != m_mixed || chars[chars.Length - 1] != '#')
+            {
+                Log.Comment("Round trip through the caller's buffers failed");
+                return MFTestResults.Fail;
+            }
+
+            //
+            // A slice from the middle of the string, which starts on one of the non-ASCII prefixes.
+            //
+            int index = m_mixed.Length / 2;
+
+            byteCount = encoding.GetBytes(m_mixed, index, 16, bytes, 0);
+            charCount = encoding.GetChars(bytes, 0, byteCount, chars, 0);
+
+            return charCount == 16 && new string(chars, 0, charCount) == m_mixed.Substring(index, 16) ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults Decoder_ReusedBuffer()
+        {
+            //
+            // Decoding into a buffer owned by the caller, as a protocol stack would.
+            //
+            byte[]  bytes   = Encoding.UTF8.GetBytes(m_ascii);
+            char[]  chars   = new char[bytes.Length];
+            Decoder decoder = Encoding.UTF8.GetDecoder();
+            int     bytesUsed;
+            int     charsUsed;
+            bool    completed = false;
+
+            long start = DateTime.Now.Ticks;
+
+            for(int i = 0; i < c_Iterations; i++)
+            {
+                decoder.Convert(bytes, 0, bytes.Length, chars, 0, chars.Length, false, out bytesUsed, out charsUsed, out completed);
+            }
+
+            long stop = DateTime.Now.Ticks;
+
+            Report("Decoder.Convert", bytes.Length, start, stop);
+
+            return completed && new string(chars) == m_ascii ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+    }
+}
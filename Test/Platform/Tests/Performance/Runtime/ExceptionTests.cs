@@ -0,0 +1,153 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+using System;
+using Microsoft.SPOT.Platform.Test;
+
+namespace Microsoft.SPOT.Platform.Tests
+{
+    public class ExceptionTests : IMFTestInterface
+    {
+        const int c_Throws   = 2000;
+        const int c_Finallys = 50000;
+
+        class Resource : IDisposable
+        {
+            public int Disposed;
+
+            public void Dispose()
+            {
+                Disposed++;
+            }
+        }
+
+        [SetUp]
+        public InitializeResult Initialize()
+        {
+            Log.Comment("Cost of throw/catch and of leaving try/finally blocks.");
+
+            return InitializeResult.ReadyToGo;
+        }
+
+        [TearDown]
+        public void CleanUp()
+        {
+        }
+
+        static void Report(string name, int count, long start, long stop)
+        {
+            long usec = (stop - start) / 10;
+
+            Log.Comment(name + ": " + count + " iterations, " + usec + " usec, " + (usec * 1000 / count) + " nsec per iteration");
+        }
+
+        static void Thrower(int depth)
+        {
+            if(depth == 0) throw new InvalidOperationException();
+
+            Thrower(depth - 1);
+        }
+
+        static int ThrowAndCatch(int count, int depth)
+        {
+            int caught = 0;
+
+            for(int i = 0; i < count; i++)
+            {
+                try
+                {
+                    Thrower(depth);
+                }
+                catch(ArgumentException)
+                {
+                }
+                catch(InvalidOperationException)
+                {
+                    caught++;
+                }
+            }
+
+            return caught;
+        }
+
+        [TestMethod]
+        public MFTestResults Exception_ThrowCatch()
+        {
+            long start  = DateTime.Now.Ticks;
+            int  caught = ThrowAndCatch(c_Throws, 0);
+            long stop   = DateTime.Now.Ticks;
+
+            Report("ThrowCatch", c_Throws, start, stop);
+
+            return caught == c_Throws ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults Exception_ThrowCatch_Depth8()
+        {
+            long start  = DateTime.Now.Ticks;
+            int  caught = ThrowAndCatch(c_Throws, 8);
+            long stop   = DateTime.Now.Ticks;
+
+            Report("ThrowCatch_Depth8", c_Throws, start, stop);
+
+            return caught == c_Throws ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults Exception_TryFinally()
+        {
+            int finallys = 0;
+
+            long start = DateTime.Now.Ticks;
+
+            for(int i = 0; i < c_Finallys; i++)
+            {
+                try
+                {
+                    try
+                    {
+                        if(i < 0) break;
+                    }
+                    catch(InvalidOperationException)
+                    {
+                    }
+                }
+                finally
+                {
+                    finallys++;
+                }
+            }
+
+            long stop = DateTime.Now.Ticks;
+
+            Report("TryFinally", c_Finallys, start, stop);
+
+            return finallys == c_Finallys ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults Exception_UsingAndLock()
+        {
+            Resource res = new Resource();
+
+            long start = DateTime.Now.Ticks;
+
+            for(int i = 0; i < c_Finallys; i++)
+            {
+                using(res)
+                {
+                    lock(res)
+                    {
+                    }
+                }
+            }
+
+            long stop = DateTime.Now.Ticks;
+
+            Report("UsingAndLock", c_Finallys, start, stop);
+
+            return res.Disposed == c_Finallys ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+    }
+}
@@ -0,0 +1,136 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+using System;
+using Microsoft.SPOT.Platform.Test;
+
+namespace Microsoft.SPOT.Platform.Tests
+{
+    public class FieldTests : IMFTestInterface
+    {
+        const int c_Calls = 50000;
+
+        class Particle
+        {
+            public int X;
+            public int Y;
+            public int VelocityX;
+            public int VelocityY;
+
+            public void Step()
+            {
+                X += VelocityX;
+                Y += VelocityY;
+            }
+        }
+
+        class Body : Particle
+        {
+            public int Steps;
+
+            public void StepAndCount()
+            {
+                Step();
+                Steps++;
+            }
+        }
+
+        struct Accumulator
+        {
+            public int Total;
+            public int Count;
+
+            public void Add(int value)
+            {
+                Total += value;
+                Count++;
+            }
+        }
+
+        [SetUp]
+        public InitializeResult Initialize()
+        {
+            Log.Comment("Instance field loads and stores in small, frequently called methods.");
+
+            return InitializeResult.ReadyToGo;
+        }
+
+        [TearDown]
+        public void CleanUp()
+        {
+        }
+
+        static void Report(string name, long start, long stop)
+        {
+            long usec = (stop - start) / 10;
+
+            Log.Comment(name + ": " + c_Calls + " calls, " + usec + " usec, " + (usec * 1000 / c_Calls) + " nsec per call");
+        }
+
+        [TestMethod]
+        public MFTestResults Field_Class()
+        {
+            Particle p = new Particle();
+
+            p.VelocityX = 2;
+            p.VelocityY = 3;
+
+            long start = DateTime.Now.Ticks;
+
+            for(int i = 0; i < c_Calls; i++)
+            {
+                p.Step();
+            }
+
+            long stop = DateTime.Now.Ticks;
+
+            Report("Class", start, stop);
+
+            return (p.X == 2 * c_Calls && p.Y == 3 * c_Calls) ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults Field_DerivedClass()
+        {
+            Body b = new Body();
+
+            b.VelocityX = 1;
+            b.VelocityY = -1;
+
+            long start = DateTime.Now.Ticks;
+
+            for(int i = 0; i < c_Calls; i++)
+            {
+                b.StepAndCount();
+            }
+
+            long stop = DateTime.Now.Ticks;
+
+            Report("DerivedClass", start, stop);
+
+            return (b.X == c_Calls && b.Y == -c_Calls && b.Steps == c_Calls) ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults Field_ValueType()
+        {
+            //
+            // The receiver is a byref to a struct, so the field accesses must keep working through the regular path.
+            //
+            Accumulator acc = new Accumulator();
+
+            long start = DateTime.Now.Ticks;
+
+            for(int i = 0; i < c_Calls; i++)
+            {
+                acc.Add(i & 7);
+            }
+
+            long stop = DateTime.Now.Ticks;
+
+            Report("ValueType", start, stop);
+
+            return (acc.Count == c_Calls && acc.Total == (c_Calls / 8) * 28) ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+    }
+}
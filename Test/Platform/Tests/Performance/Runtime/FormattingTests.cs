@@ -0,0 +1,132 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+using System;
+using Microsoft.SPOT.Platform.Test;
+
+namespace Microsoft.SPOT.Platform.Tests
+{
+    public class FormattingTests : IMFTestInterface
+    {
+        const int c_Iterations = 5000;
+
+        [SetUp]
+        public InitializeResult Initialize()
+        {
+            Log.Comment("Number.ToString speed and output for integer and floating point formats.");
+
+            return InitializeResult.ReadyToGo;
+        }
+
+        [TearDown]
+        public void CleanUp()
+        {
+        }
+
+        static void Report(string name, long start, long stop)
+        {
+            long usec = (stop - start) / 10;
+
+            Log.Comment(name + ": " + c_Iterations + " conversions, " + usec + " usec, " + (usec * 1000 / c_Iterations) + " nsec each");
+        }
+
+        static bool Check(string actual, string expected)
+        {
+            if(actual == expected) return true;
+
+            Log.Comment("Expected '" + expected + "', got '" + actual + "'");
+
+            return false;
+        }
+
+        [TestMethod]
+        public MFTestResults Format_Integers()
+        {
+            bool ok = true;
+
+            ok &= Check(( 0            ).ToString()    , "0"                   );
+            ok &= Check(( -123456789   ).ToString()    , "-123456789"          );
+            ok &= Check(( int.MinValue ).ToString()    , "-2147483648"         );
+            ok &= Check(( uint.MaxValue).ToString()    , "4294967295"          );
+            ok &= Check(( long.MinValue).ToString()    , "-9223372036854775808");
+            ok &= Check((ulong.MaxValue).ToString()    , "18446744073709551615");
+            ok &= Check(( 42           ).ToString("D5"), "00042"               );
+            ok &= Check(( -42          ).ToString("D5"), "-00042"              );
+            ok &= Check(( 0x2c45e      ).ToString("x") , "2c45e"               );
+            ok &= Check(( 0x2c45e      ).ToString("X8"), "0002C45E"            );
+            ok &= Check(( -1           ).ToString("X") , "FFFFFFFF"            );
+            ok &= Check(((short)-1     ).ToString("X") , "FFFF"                );
+            ok &= Check(((sbyte)-2     ).ToString("x") , "fe"                  );
+            ok &= Check(((short)-300   ).ToString("D5"), "-00300"              );
+
+            long start = DateTime.Now.Ticks;
+
+            for(int i = 0; i < c_Iterations; i++)
+            {
+                (i * 7919).ToString();
+            }
+
+            long stop = DateTime.Now.Ticks;
+
+            Report("Int32.ToString()", start, stop);
+
+            start = DateTime.Now.Ticks;
+
+            for(int i = 0; i < c_Iterations; i++)
+            {
+                (i * 7919).ToString("X8");
+            }
+
+            stop = DateTime.Now.Ticks;
+
+            Report("Int32.ToString(\"X8\")", start, stop);
+
+            return ok ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults Format_Floats()
+        {
+            bool ok = true;
+
+            ok &= Check((0.1       ).ToString()    , "0.1"      );
+            ok &= Check((1234.5    ).ToString()    , "1234.5"   );
+            ok &= Check((-0.00125  ).ToString()    , "-0.00125" );
+            ok &= Check((100.0     ).ToString()    , "100"      );
+            ok &= Check((0.1f      ).ToString()    , "0.1"      );
+            ok &= Check((3.14159f  ).ToString()    , "3.14159"  );
+            ok &= Check((2.5       ).ToString("F2"), "2.50"     );
+            ok &= Check((-1.005e3  ).ToString("F1"), "-1005.0"  );
+            ok &= Check((1234567.25).ToString("N2"), "1,234,567.25");
+
+            double value = 0.1;
+            double back  = double.Parse(value.ToString());
+
+            ok &= (back == value);
+
+            long start = DateTime.Now.Ticks;
+
+            for(int i = 0; i < c_Iterations; i++)
+            {
+                (i * 0.37).ToString();
+            }
+
+            long stop = DateTime.Now.Ticks;
+
+            Report("Double.ToString()", start, stop);
+
+            start = DateTime.Now.Ticks;
+
+            for(int i = 0; i < c_Iterations; i++)
+            {
+                (i * 0.37).ToString("F2");
+            }
+
+            stop = DateTime.Now.Ticks;
+
+            Report("Double.ToString(\"F2\")", start, stop);
+
+            return ok ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+    }
+}
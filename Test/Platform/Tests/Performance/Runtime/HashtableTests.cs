@@ -0,0 +1,82 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+using System;
+using System.Collections;
+using Microsoft.SPOT.Platform.Test;
+
+namespace Microsoft.SPOT.Platform.Tests
+{
+    public class HashtableTests : IMFTestInterface
+    {
+        const int c_Keys    = 200;
+        const int c_Lookups = 20000;
+
+        string[] m_keys;
+
+        [SetUp]
+        public InitializeResult Initialize()
+        {
+            Log.Comment("Hashtable lookups keyed by long strings, as in config parsing and routing tables.");
+
+            m_keys = new string[c_Keys];
+
+            for(int i = 0; i < c_Keys; i++)
+            {
+                m_keys[i] = "/devices/sensors/temperature/channel/" + i.ToString() + "/calibration";
+            }
+
+            return InitializeResult.ReadyToGo;
+        }
+
+        [TearDown]
+        public void CleanUp()
+        {
+            m_keys = null;
+        }
+
+        [TestMethod]
+        public MFTestResults Hashtable_StringKeys()
+        {
+            Hashtable table = new Hashtable();
+
+            for(int i = 0; i < c_Keys; i++)
+            {
+                table[m_keys[i]] = i;
+            }
+
+            long start = DateTime.Now.Ticks;
+            int  sum   = 0;
+
+            for(int i = 0; i < c_Lookups; i++)
+            {
+                sum += (int)table[m_keys[i % c_Keys]];
+            }
+
+            long stop = DateTime.Now.Ticks;
+            long usec = (stop - start) / 10;
+
+            Log.Comment("String keys: " + c_Lookups + " lookups, " + usec + " usec, " + (usec * 1000 / c_Lookups) + " nsec per lookup");
+
+            int expected = (c_Lookups / c_Keys) * (c_Keys * (c_Keys - 1) / 2);
+
+            return sum == expected ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults Hashtable_EqualStringsHashEqual()
+        {
+            //
+            // A string built at run time and its literal twin must still land in the same bucket.
+            //
+            string built   = "cali" + "bration".ToString();
+            string literal = "calibration";
+
+            Hashtable table = new Hashtable();
+
+            table[literal] = 1;
+
+            return built.GetHashCode() == literal.GetHashCode() && table.Contains(built) ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+    }
+}
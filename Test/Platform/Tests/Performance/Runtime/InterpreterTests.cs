@@ -0,0 +1,147 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+using System;
+using Microsoft.SPOT.Platform.Test;
+
+namespace Microsoft.SPOT.Platform.Tests
+{
+    //
+    // GCC builds dispatch opcodes through a computed goto table. Building the same solution with
+    // /p:PLATFORM_NO_THREADED_DISPATCH=true gives the plain switch, and the CLR suites, these
+    // benchmarks included, are run against both images; the boot log names the mode of each run.
+    //
+    public class InterpreterTests : IMFTestInterface
+    {
+        const int c_Iterations = 200000;
+        const int c_Calls      = 100;    // enough calls for a quickening build to rewrite the method
+
+        //
+        // IL instructions per loop iteration in a release build, used to turn the elapsed time into MIPS.
+        //
+        const int c_InstructionsPerIteration_Arithmetic = 11; // ldloc ldloc add stloc / ldloc ldc add stloc / ldloc ldarg blt
+        const int c_InstructionsPerIteration_Fields     = 15; // ldloc ldarg.0 ldfld ldarg.0 ldfld add add stloc / ... / ...
+        const int c_InstructionsPerIteration_Compare    = 14; // ldloc ldarg ceq brfalse ldloc ldc add stloc / ... / ...
+
+        int m_first  = 3;
+        int m_second = 4;
+
+        [SetUp]
+        public InitializeResult Initialize()
+        {
+            Log.Comment("Interpreter dispatch speed, in millions of IL instructions per second.");
+
+            return InitializeResult.ReadyToGo;
+        }
+
+        [TearDown]
+        public void CleanUp()
+        {
+        }
+
+        static int Arithmetic(int iterations)
+        {
+            int sum = 0;
+
+            for(int i = 0; i < iterations; i++)
+            {
+                sum += i;
+            }
+
+            return sum;
+        }
+
+        int Fields(int iterations)
+        {
+            int sum = 0;
+
+            for(int i = 0; i < iterations; i++)
+            {
+                sum += m_first + m_second;
+            }
+
+            return sum;
+        }
+
+        static int Compare(int iterations, int match)
+        {
+            int hits = 0;
+
+            for(int i = 0; i < iterations; i++)
+            {
+                bool equal = (i == match);
+
+                if(equal) hits++;
+            }
+
+            return hits;
+        }
+
+        static void Report(string name, int instructionsPerIteration, long start, long stop)
+        {
+            long usec = (stop - start) / 10;
+
+            if(usec == 0) usec = 1;
+
+            Log.Comment(name + ": " + c_Iterations + " iterations, " + usec + " usec, " + ((long)c_Iterations * instructionsPerIteration / usec) + " MIPS (approx.)");
+        }
+
+        [TestMethod]
+        public MFTestResults Interpreter_Arithmetic()
+        {
+            long start  = DateTime.Now.Ticks;
+            int  result = Arithmetic(c_Iterations);
+            long stop   = DateTime.Now.Ticks;
+
+            Report("Arithmetic", c_InstructionsPerIteration_Arithmetic, start, stop);
+
+            return result == (int)((long)c_Iterations * (c_Iterations - 1) / 2) ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults Interpreter_Fields()
+        {
+            long start  = DateTime.Now.Ticks;
+            int  result = Fields(c_Iterations);
+            long stop   = DateTime.Now.Ticks;
+
+            Report("Fields", c_InstructionsPerIteration_Fields, start, stop);
+
+            return result == c_Iterations * (m_first + m_second) ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        //
+        // Same loop as Interpreter_Fields, split over many calls so the method is hot: with quickening its
+        // ldfld run in their quick form, and this measures the ldarg.0 + ldfld fusion on that form.
+        //
+        [TestMethod]
+        public MFTestResults Interpreter_FieldsHot()
+        {
+            int  result = 0;
+            long start  = DateTime.Now.Ticks;
+
+            for(int i = 0; i < c_Calls; i++)
+            {
+                result += Fields(c_Iterations / c_Calls);
+            }
+
+            long stop = DateTime.Now.Ticks;
+
+            Report("FieldsHot", c_InstructionsPerIteration_Fields, start, stop);
+
+            return result == c_Iterations * (m_first + m_second) ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults Interpreter_CompareAndBranch()
+        {
+            long start  = DateTime.Now.Ticks;
+            int  result = Compare(c_Iterations, c_Iterations / 2);
+            long stop   = DateTime.Now.Ticks;
+
+            Report("CompareAndBranch", c_InstructionsPerIteration_Compare, start, stop);
+
+            return result == 1 ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+    }
+}
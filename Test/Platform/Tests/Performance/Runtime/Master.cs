@@ -0,0 +1,17 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+using System;
+using Microsoft.SPOT.Platform.Test;
+
+namespace Microsoft.SPOT.Platform.Tests
+{
+    public class Master_Runtime
+    {
+        public static void Main()
+        {
+            string[] args = { "WaitHandleTests", "TimerTests", "CallTests", "InterpreterTests", "FieldTests", "StaticFieldTests", "ExceptionTests", "BoxingTests", "ArrayTests", "CollectionTests", "HashtableTests", "FormattingTests", "ParsingTests", "EncodingTests" };
+            MFTestRunner runner = new MFTestRunner(args);
+        }
+    }
+}
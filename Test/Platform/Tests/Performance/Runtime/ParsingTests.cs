@@ -0,0 +1,137 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+using System;
+using Microsoft.SPOT.Platform.Test;
+
+namespace Microsoft.SPOT.Platform.Tests
+{
+    public class ParsingTests : IMFTestInterface
+    {
+        const int c_Values = 1000;
+
+        string[] m_integers;
+        string[] m_doubles;
+
+        [SetUp]
+        public InitializeResult Initialize()
+        {
+            Log.Comment("Int32.Parse and Double.Parse over sensor-style numeric datasets.");
+
+            m_integers = new string[c_Values];
+            m_doubles  = new string[c_Values];
+
+            for(int i = 0; i < c_Values; i++)
+            {
+                m_integers[i] = (i * 104729 - 50000000).ToString();
+                m_doubles [i] = (i * 0.37 - 100.0).ToString();
+            }
+
+            return InitializeResult.ReadyToGo;
+        }
+
+        [TearDown]
+        public void CleanUp()
+        {
+            m_integers = null;
+            m_doubles  = null;
+        }
+
+        static void Report(string name, long start, long stop)
+        {
+            long usec = (stop - start) / 10;
+
+            Log.Comment(name + ": " + c_Values + " values, " + usec + " usec, " + (usec * 1000 / c_Values) + " nsec each");
+        }
+
+        static bool Throws(string value, bool isDouble)
+        {
+            try
+            {
+                if(isDouble) double.Parse(value);
+                else         ulong .Parse(value);
+            }
+            catch(Exception)
+            {
+                return true;
+            }
+
+            Log.Comment("Expected '" + value + "' to be rejected");
+
+            return false;
+        }
+
+        [TestMethod]
+        public MFTestResults Parse_Integers()
+        {
+            bool ok = true;
+
+            ok &= int  .Parse("  -2147483648 ") == int.MinValue;
+            ok &= uint .Parse("4294967295"    ) == uint.MaxValue;
+            ok &= long .Parse("+0042"         ) == 42;
+            ok &= ulong.Parse("18446744073709551615") == ulong.MaxValue;
+            ok &= long .Parse("-9223372036854775808") == long.MinValue;
+            ok &= Throws("-1"                  , false);
+            ok &= Throws("18446744073709551616", false);
+            ok &= Throws("12a"                 , false);
+            ok &= Throws("-"                   , false);
+
+            long start = DateTime.Now.Ticks;
+            long sum   = 0;
+
+            for(int i = 0; i < c_Values; i++)
+            {
+                sum += int.Parse(m_integers[i]);
+            }
+
+            long stop = DateTime.Now.Ticks;
+
+            Report("Int32.Parse", start, stop);
+
+            long expected = 104729L * c_Values * (c_Values - 1) / 2 - 50000000L * c_Values;
+
+            return ok && sum == expected ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults Parse_Doubles()
+        {
+            bool ok = true;
+
+            ok &= double.Parse("0.1"                    ) == 0.1;
+            ok &= double.Parse(" -1234.5 "              ) == -1234.5;
+            ok &= double.Parse("1e5"                    ) == 100000.0;
+            ok &= double.Parse("6.02214076E23"          ) == 6.02214076E23;
+            ok &= double.Parse("0.000001"               ) == 1e-6;
+            ok &= double.Parse("9007199254740993"       ) == 9007199254740992.0;
+            ok &= double.Parse("1.7976931348623157e308" ) == double.MaxValue;
+            ok &= double.Parse("2.2250738585072011e-308") == 2.2250738585072011e-308;
+            ok &= double.Parse("123456789012345678901234567890") == 123456789012345678901234567890.0;
+            ok &= Throws("1e400", true);
+            ok &= Throws("1.2.3", true);
+            ok &= Throws("1e"   , true);
+
+            double[] values = new double[c_Values];
+            long     start  = DateTime.Now.Ticks;
+
+            for(int i = 0; i < c_Values; i++)
+            {
+                values[i] = double.Parse(m_doubles[i]);
+            }
+
+            long stop = DateTime.Now.Ticks;
+
+            Report("Double.Parse", start, stop);
+
+            //
+            // Every shortest-form value must round trip exactly.
+            //
+            for(int i = 0; i < c_Values; i++)
+            {
+                ok &= values[i] == (i * 0.37 - 100.0);
+            }
+
+            return ok ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+    }
+}
@@ -0,0 +1,102 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+using System;
+using Microsoft.SPOT.Platform.Test;
+
+namespace Microsoft.SPOT.Platform.Tests
+{
+    public class StaticFieldTests : IMFTestInterface
+    {
+        const int c_Iterations = 20000;
+
+        public class StaticWorker : MarshalByRefObject
+        {
+            static int    s_counter;
+            static int    s_step = 1;
+            static string s_name = "worker";
+
+            //
+            // Alternates between statics of this assembly and of mscorlib, so a single-entry lookup cache keeps missing.
+            //
+            public int Run(int iterations)
+            {
+                int length = 0;
+
+                s_counter = 0;
+
+                for(int i = 0; i < iterations; i++)
+                {
+                    s_counter += s_step;
+
+                    if(s_name != String.Empty) length++;
+                }
+
+                return s_counter == iterations && length == iterations ? s_counter : -1;
+            }
+        }
+
+        [SetUp]
+        public InitializeResult Initialize()
+        {
+            Log.Comment("Static field loads and stores with one and several application domains.");
+
+            return InitializeResult.ReadyToGo;
+        }
+
+        [TearDown]
+        public void CleanUp()
+        {
+        }
+
+        bool RunDomains(int domains)
+        {
+            string      assembly = typeof(StaticFieldTests).Assembly.FullName;
+            AppDomain[] extra    = new AppDomain[domains - 1];
+            bool        success  = true;
+
+            for(int i = 0; i < extra.Length; i++)
+            {
+                extra[i] = AppDomain.CreateDomain("StaticFieldTests #" + i);
+                extra[i].Load(assembly);
+            }
+
+            try
+            {
+                for(int d = 0; d < domains; d++)
+                {
+                    StaticWorker worker = d == 0 ? new StaticWorker() : (StaticWorker)extra[d - 1].CreateInstanceAndUnwrap(assembly, typeof(StaticWorker).FullName);
+
+                    long start  = DateTime.Now.Ticks;
+                    int  result = worker.Run(c_Iterations);
+                    long stop   = DateTime.Now.Ticks;
+
+                    Log.Comment("Domains: " + domains + ", domain " + d + ": " + c_Iterations + " iterations, " + ((stop - start) / 10) + " usec");
+
+                    if(result != c_Iterations) success = false;
+                }
+            }
+            finally
+            {
+                for(int i = 0; i < extra.Length; i++)
+                {
+                    AppDomain.Unload(extra[i]);
+                }
+            }
+
+            return success;
+        }
+
+        [TestMethod]
+        public MFTestResults StaticField_1_Domain()
+        {
+            return RunDomains(1) ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults StaticField_4_Domains()
+        {
+            return RunDomains(4) ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+    }
+}
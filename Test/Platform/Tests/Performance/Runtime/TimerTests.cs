@@ -0,0 +1,137 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+using System;
+using System.Threading;
+using Microsoft.SPOT.Platform.Test;
+
+namespace Microsoft.SPOT.Platform.Tests
+{
+    public class TimerTests : IMFTestInterface
+    {
+        const int c_RunMilliseconds = 2000;
+
+        [SetUp]
+        public InitializeResult Initialize()
+        {
+            Log.Comment("Callback rate and dispatch latency of fast periodic timers.");
+
+            return InitializeResult.ReadyToGo;
+        }
+
+        [TearDown]
+        public void CleanUp()
+        {
+        }
+
+        class PeriodicCallback
+        {
+            int  m_period;
+            long m_start;
+
+            public int  Fired;
+            public long LatencyTotal;
+            public long LatencyMax;
+
+            public PeriodicCallback(int period)
+            {
+                m_period = period;
+            }
+
+            public Timer Start(long start)
+            {
+                m_start = start;
+
+                return new Timer(new TimerCallback(Tick), null, m_period, m_period);
+            }
+
+            void Tick(object state)
+            {
+                long now     = DateTime.Now.Ticks;
+                long due     = m_start + (long)(Fired + 1) * m_period * TimeSpan.TicksPerMillisecond;
+                long latency = now > due ? now - due : 0;
+
+                //
+                // A late timer is rescheduled from its last expiration, so drift does not accumulate past one period.
+                //
+                if(latency > m_period * TimeSpan.TicksPerMillisecond)
+                {
+                    m_start += (latency / (m_period * TimeSpan.TicksPerMillisecond)) * m_period * TimeSpan.TicksPerMillisecond;
+                    latency  =  latency % (m_period * TimeSpan.TicksPerMillisecond);
+                }
+
+                Fired++;
+                LatencyTotal += latency;
+
+                if(latency > LatencyMax) LatencyMax = latency;
+            }
+        }
+
+        bool RunTimers(int count, int period)
+        {
+            PeriodicCallback[] callbacks = new PeriodicCallback[count];
+            Timer[]            timers    = new Timer[count];
+
+            for(int i = 0; i < count; i++)
+            {
+                callbacks[i] = new PeriodicCallback(period);
+            }
+
+            //
+            // Start every timer from the same base so they share a due tick.
+            //
+            long start = DateTime.Now.Ticks;
+
+            for(int i = 0; i < count; i++)
+            {
+                timers[i] = callbacks[i].Start(start);
+            }
+
+            Thread.Sleep(c_RunMilliseconds);
+
+            for(int i = 0; i < count; i++)
+            {
+                timers[i].Dispose();
+            }
+
+            int  fired        = 0;
+            long latencyTotal = 0;
+            long latencyMax   = 0;
+
+            for(int i = 0; i < count; i++)
+            {
+                fired        += callbacks[i].Fired;
+                latencyTotal += callbacks[i].LatencyTotal;
+
+                if(callbacks[i].LatencyMax > latencyMax) latencyMax = callbacks[i].LatencyMax;
+            }
+
+            Log.Comment("Timers: " + count + ", period: " + period + " ms, callbacks: " + fired + ", expected: " + (count * c_RunMilliseconds / period));
+
+            if(fired > 0)
+            {
+                Log.Comment("Latency usec, avg: " + (latencyTotal / 10 / fired) + ", max: " + (latencyMax / 10));
+            }
+
+            return fired > 0;
+        }
+
+        [TestMethod]
+        public MFTestResults Timer_1_Every_1ms()
+        {
+            return RunTimers(1, 1) ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults Timer_4_Every_5ms()
+        {
+            return RunTimers(4, 5) ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults Timer_16_Every_10ms()
+        {
+            return RunTimers(16, 10) ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+    }
+}
@@ -0,0 +1,137 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+using System;
+using System.Threading;
+using Microsoft.SPOT.Platform.Test;
+
+namespace Microsoft.SPOT.Platform.Tests
+{
+    public class WaitHandleTests : IMFTestInterface
+    {
+        const int c_RoundTrips = 1000;
+
+        AutoResetEvent m_ping;
+        AutoResetEvent m_pong;
+        int            m_received;
+
+        ManualResetEvent m_release;
+        Thread[]         m_idleThreads;
+
+        [SetUp]
+        public InitializeResult Initialize()
+        {
+            Log.Comment("Producer/consumer ping-pong latency with idle waiters.");
+
+            return InitializeResult.ReadyToGo;
+        }
+
+        [TearDown]
+        public void CleanUp()
+        {
+        }
+
+        void Consumer()
+        {
+            for(int i = 0; i < c_RoundTrips; i++)
+            {
+                m_ping.WaitOne();
+                m_received++;
+                m_pong.Set();
+            }
+        }
+
+        class IdleWaiter
+        {
+            WaitHandle[] m_handles;
+
+            public IdleWaiter(ManualResetEvent release)
+            {
+                //
+                // Each idle thread waits on its own event plus the shared release event.
+                //
+                m_handles = new WaitHandle[] { new AutoResetEvent(false), release };
+            }
+
+            public void Run()
+            {
+                WaitHandle.WaitAny(m_handles);
+            }
+        }
+
+        void StartIdleWaiters(int count)
+        {
+            m_release     = new ManualResetEvent(false);
+            m_idleThreads = new Thread[count];
+
+            for(int i = 0; i < count; i++)
+            {
+                m_idleThreads[i] = new Thread(new IdleWaiter(m_release).Run);
+                m_idleThreads[i].Start();
+            }
+
+            //
+            // Let every idle thread block before measuring.
+            //
+            Thread.Sleep(200);
+        }
+
+        void StopIdleWaiters()
+        {
+            m_release.Set();
+
+            for(int i = 0; i < m_idleThreads.Length; i++)
+            {
+                m_idleThreads[i].Join();
+            }
+        }
+
+        bool PingPong(int idleWaiters)
+        {
+            StartIdleWaiters(idleWaiters);
+
+            m_ping     = new AutoResetEvent(false);
+            m_pong     = new AutoResetEvent(false);
+            m_received = 0;
+
+            Thread consumer = new Thread(Consumer);
+            consumer.Start();
+
+            long start = DateTime.Now.Ticks;
+
+            for(int i = 0; i < c_RoundTrips; i++)
+            {
+                m_ping.Set();
+                m_pong.WaitOne();
+            }
+
+            long stop = DateTime.Now.Ticks;
+
+            consumer.Join();
+
+            StopIdleWaiters();
+
+            Log.Comment("Idle waiters: " + idleWaiters + ", round trips: " + c_RoundTrips + ", usec per round trip: " + ((stop - start) / 10 / c_RoundTrips));
+
+            return m_received == c_RoundTrips;
+        }
+
+        [TestMethod]
+        public MFTestResults PingPong_NoIdleWaiters()
+        {
+            return PingPong(0) ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults PingPong_8_IdleWaiters()
+        {
+            return PingPong(8) ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults PingPong_32_IdleWaiters()
+        {
+            return PingPong(32) ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+    }
+}
@@ -0,0 +1,192 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+using System;
+using System.Net;
+using System.Net.Sockets;
+using System.Threading;
+using Microsoft.SPOT.Platform.Test;
+
+namespace Microsoft.SPOT.Platform.Tests
+{
+    public class BulkReceiveTests : IMFTestInterface
+    {
+        const int c_Total     = 256 * 1024;
+        const int c_SendChunk = 512;
+        const int c_RecvChunk = 8192;
+
+        Socket m_listener;
+        Socket m_client;
+        Socket m_server;
+
+        [SetUp]
+        public InitializeResult Initialize()
+        {
+            Log.Comment("Loopback bulk transfer: receive throughput and how many segments each Receive drains.");
+
+            m_listener = new Socket(AddressFamily.InterNetwork, SocketType.Stream, ProtocolType.Tcp);
+            m_listener.Bind(new IPEndPoint(IPAddress.Loopback, 0));
+            m_listener.Listen(1);
+
+            m_client = new Socket(AddressFamily.InterNetwork, SocketType.Stream, ProtocolType.Tcp);
+            m_client.Connect(m_listener.LocalEndPoint);
+
+            m_server = m_listener.Accept();
+
+            return InitializeResult.ReadyToGo;
+        }
+
+        [TearDown]
+        public void CleanUp()
+        {
+            m_client  .Close();
+            m_server  .Close();
+            m_listener.Close();
+        }
+
+        class Sender
+        {
+            Socket m_socket;
+            int    m_total;
+            int    m_chunk;
+
+            public Sender(Socket socket, int total, int chunk)
+            {
+                m_socket = socket;
+                m_total  = total;
+                m_chunk  = chunk;
+            }
+
+            public void Run()
+            {
+                byte[] chunk = new byte[m_chunk];
+
+                //
+                // Small writes, each pushed as its own segment, the worst case for the receiver.
+                //
+                for(int sent = 0; sent < m_total; sent += m_chunk)
+                {
+                    for(int i = 0; i < m_chunk; i++) chunk[i] = (byte)(sent + i);
+
+                    m_socket.Send(chunk);
+                }
+            }
+        }
+
+        //
+        // Sends total bytes from client to server in sendChunk writes and checks them as they arrive.
+        // SocketBenchmarkTests runs the same transfer on every path.
+        //
+        public static bool Transfer(Socket client, Socket server, int total, int sendChunk, out int received, out int calls, out long usec)
+        {
+            byte[] buffer = new byte[c_RecvChunk];
+            bool   ok     = true;
+
+            received = 0;
+            calls    = 0;
+
+            Thread sender = new Thread(new ThreadStart(new Sender(client, total, sendChunk).Run));
+
+            long start = DateTime.Now.Ticks;
+
+            sender.Start();
+
+            while(received < total)
+            {
+                int read = server.Receive(buffer);
+
+                if(read <= 0) break;
+
+                //
+                // Every byte is the low byte of its offset in the stream.
+                //
+                if(buffer[0] != (byte)received || buffer[read - 1] != (byte)(received + read - 1)) ok = false;
+
+                received += read;
+                calls++;
+            }
+
+            usec = (DateTime.Now.Ticks - start) / 10;
+
+            sender.Join();
+
+            if(usec == 0) usec = 1;
+
+            return ok && received == total;
+        }
+
+        [TestMethod]
+        public MFTestResults Sockets_BulkReceive()
+        {
+            int  received;
+            int  calls;
+            long usec;
+
+            bool ok = Transfer(m_client, m_server, c_Total, c_SendChunk, out received, out calls, out usec);
+
+            Log.Comment("Received " + received + " bytes in " + calls + " Receive calls, " + (received / calls) + " bytes per call");
+            Log.Comment("Segments drained per call: " + (received / calls / c_SendChunk) + " (approx.)");
+            Log.Comment("Throughput: " + ((long)received * 1000000 / 1024 / usec) + " KB/s");
+
+            SocketTools.ReportResult("tcp_bulk_receive", "loopback", "throughput", (long)received * 1000000 / usec, "bytes/s");
+            SocketTools.ReportResult("tcp_bulk_receive", "loopback", "bytes_per_receive", received / calls, "bytes");
+
+            return ok ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults Sockets_ReceiveAfterClose()
+        {
+            //
+            // Data followed straight away by the peer's close: a Receive that drains the data together with the
+            // end of the stream must still leave the end of the stream for the next Receive to report.
+            //
+            Socket client = new Socket(AddressFamily.InterNetwork, SocketType.Stream, ProtocolType.Tcp);
+            Socket server = null;
+            byte[] buffer = new byte[c_RecvChunk];
+            int    read   = -1;
+
+            try
+            {
+                client.Connect(m_listener.LocalEndPoint);
+
+                server = m_listener.Accept();
+                server.ReceiveTimeout = 5000;
+
+                client.Send(new byte[c_SendChunk]);
+                client.Close();
+
+                //
+                // Give the data and the FIN time to be queued behind each other before the first Receive.
+                //
+                Thread.Sleep(200);
+
+                int received = server.Receive(buffer);
+
+                if(received != c_SendChunk)
+                {
+                    Log.Comment("Expected " + c_SendChunk + " bytes, received " + received);
+                    return MFTestResults.Fail;
+                }
+
+                if(!server.Poll(5000000, SelectMode.SelectRead))
+                {
+                    Log.Comment("The end of the stream did not leave the socket readable");
+                    return MFTestResults.Fail;
+                }
+
+                read = server.Receive(buffer);
+            }
+            catch(SocketException e)
+            {
+                Log.Comment("Receive after close failed: " + e.ErrorCode);
+            }
+            finally
+            {
+                if(server != null) server.Close();
+            }
+
+            return read == 0 ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+    }
+}
@@ -0,0 +1,205 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+using System;
+using System.Net;
+using System.Net.Sockets;
+using System.Threading;
+using Microsoft.SPOT.Net.NetworkInformation;
+using Microsoft.SPOT.Platform.Test;
+
+namespace Microsoft.SPOT.Platform.Tests
+{
+    public class DnsCacheTests : IMFTestInterface
+    {
+        const int  c_Lookups       = 20;
+        const byte c_AnswerTtl     = 60;
+        const byte c_RcodeNxDomain = 3;
+
+        static readonly byte[] s_answerAddress = { 10, 1, 2, 3 };
+
+        NetworkInterface m_interface;
+        string[]         m_savedDns;
+        bool             m_savedDynamicDns;
+        Socket           m_resolver;
+        Thread           m_resolverThread;
+        int              m_queries;
+
+        [SetUp]
+        public InitializeResult Initialize()
+        {
+            Log.Comment("Host name lookups against a stub DNS server on loopback: the network stack should only query it on a cache miss.");
+
+            m_resolver = new Socket(AddressFamily.InterNetwork, SocketType.Dgram, ProtocolType.Udp);
+            m_resolver.Bind(new IPEndPoint(IPAddress.Loopback, 53));
+
+            m_resolverThread = new Thread(new ThreadStart(Serve));
+            m_resolverThread.Start();
+
+            m_interface       = NetworkInterface.GetAllNetworkInterfaces()[0];
+            m_savedDns        = m_interface.DnsAddresses;
+            m_savedDynamicDns = m_interface.IsDynamicDnsEnabled;
+
+            m_interface.EnableStaticDns(new string[] { "127.0.0.1" });
+
+            return InitializeResult.ReadyToGo;
+        }
+
+        [TearDown]
+        public void CleanUp()
+        {
+            // EnableStaticDns rejects an empty list, 0.0.0.0 stores no server at all; the addresses
+            // go back first so that dynamic DNS does not keep the loopback resolver either
+            m_interface.EnableStaticDns(m_savedDns.Length > 0 ? m_savedDns : new string[] { "0.0.0.0" });
+
+            if(m_savedDynamicDns)
+            {
+                m_interface.EnableDynamicDns();
+            }
+
+            m_resolver.Close();
+            m_resolverThread.Join();
+        }
+
+        //
+        // Answers every query with a single A record, except names starting with "missing" which get NXDOMAIN.
+        //
+        void Serve()
+        {
+            byte[]   buffer = new byte[512];
+            EndPoint remote = new IPEndPoint(IPAddress.Any, 0);
+
+            try
+            {
+                while(true)
+                {
+                    int len = m_resolver.ReceiveFrom(buffer, ref remote);
+
+                    if(len < 12) continue;
+
+                    Interlocked.Increment(ref m_queries);
+
+                    // question section: labels, then type and class
+                    int end = 12;
+                    while(end < len && buffer[end] != 0) end += buffer[end] + 1;
+                    end += 5;
+
+                    if(end > len) continue;
+
+                    bool missing = buffer[13] == 'm' && buffer[14] == 'i' && buffer[15] == 's';
+
+                    buffer[2] = 0x81;                                   // response, recursion desired
+                    buffer[3] = missing ? (byte)(0x80 | c_RcodeNxDomain) : (byte)0x80;
+                    buffer[6] = 0; buffer[7] = missing ? (byte)0 : (byte)1;   // answer count
+                    buffer[8] = 0; buffer[9] = 0;
+                    buffer[10] = 0; buffer[11] = 0;
+
+                    if(!missing)
+                    {
+                        byte[] answer = { 0xC0, 12, 0, 1, 0, 1, 0, 0, 0, c_AnswerTtl, 0, 4 };
+
+                        Array.Copy(answer, 0, buffer, end, answer.Length);
+                        end += answer.Length;
+
+                        Array.Copy(s_answerAddress, 0, buffer, end, s_answerAddress.Length);
+                        end += s_answerAddress.Length;
+                    }
+
+                    m_resolver.SendTo(buffer, 0, end, SocketFlags.None, remote);
+                }
+            }
+            catch(Exception)
+            {
+                // socket closed in CleanUp
+            }
+        }
+
+        static string UniqueName(string prefix)
+        {
+            // the cache outlives a test run, so never reuse a name
+            return prefix + DateTime.Now.Ticks + ".test";
+        }
+
+        [TestMethod]
+        public MFTestResults DnsCache_RepeatLookup()
+        {
+            string name  = UniqueName("host");
+            int    start = m_queries;
+
+            long        ticks = DateTime.Now.Ticks;
+            IPHostEntry entry = Dns.GetHostEntry(name);
+            long        miss  = (DateTime.Now.Ticks - ticks) / 10;
+
+            ticks = DateTime.Now.Ticks;
+
+            for(int i = 0; i < c_Lookups; i++)
+            {
+                entry = Dns.GetHostEntry(name);
+            }
+
+            long hit = (DateTime.Now.Ticks - ticks) / 10 / c_Lookups;
+
+            Log.Comment("First lookup: " + miss + " usec");
+            Log.Comment("Cached lookup: " + hit + " usec");
+            Log.Comment("Queries sent: " + (m_queries - start));
+
+            if(entry.AddressList.Length != 1 || !entry.AddressList[0].Equals(new IPAddress(s_answerAddress)))
+            {
+                Log.Exception("Unexpected address " + entry.AddressList[0].ToString());
+                return MFTestResults.Fail;
+            }
+
+            return (m_queries - start) == 1 ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults DnsCache_NegativeLookup()
+        {
+            string name     = UniqueName("missing");
+            int    start    = m_queries;
+            int    failures = 0;
+
+            for(int i = 0; i < c_Lookups; i++)
+            {
+                try
+                {
+                    Dns.GetHostEntry(name);
+                }
+                catch(SocketException)
+                {
+                    failures++;
+                }
+            }
+
+            Log.Comment("Failed lookups: " + failures + ", queries sent: " + (m_queries - start));
+
+            return (failures == c_Lookups && (m_queries - start) == 1) ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults DnsCache_BeginGetHostEntry()
+        {
+            string         name      = UniqueName("async");
+            AutoResetEvent completed = new AutoResetEvent(false);
+            object         state     = new object();
+            object         seen      = null;
+
+            IAsyncResult result = Dns.BeginGetHostEntry(name, delegate(IAsyncResult ar) { seen = state; completed.Set(); }, state);
+
+            if(!completed.WaitOne(30000, false))
+            {
+                Log.Exception("Callback was not invoked");
+                return MFTestResults.Fail;
+            }
+
+            IPHostEntry entry = Dns.EndGetHostEntry(result);
+
+            if(seen != state || entry.AddressList.Length != 1 || !entry.AddressList[0].Equals(new IPAddress(s_answerAddress)))
+            {
+                return MFTestResults.Fail;
+            }
+
+            return MFTestResults.Pass;
+        }
+    }
+}
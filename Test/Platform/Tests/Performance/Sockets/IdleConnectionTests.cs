@@ -0,0 +1,146 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+using System;
+using System.Net;
+using System.Net.Sockets;
+using System.Threading;
+using Microsoft.SPOT.Platform.Test;
+
+namespace Microsoft.SPOT.Platform.Tests
+{
+    public class IdleConnectionTests : IMFTestInterface
+    {
+        const int c_IdleConnections = 6;
+        const int c_Messages        = 200;
+
+        [SetUp]
+        public InitializeResult Initialize()
+        {
+            Log.Comment("Round trip latency on one loopback connection while other connections sit idle in Poll.");
+
+            return InitializeResult.ReadyToGo;
+        }
+
+        [TearDown]
+        public void CleanUp()
+        {
+        }
+
+        static void Connect(Socket listener, out Socket client, out Socket server)
+        {
+            client = new Socket(AddressFamily.InterNetwork, SocketType.Stream, ProtocolType.Tcp);
+            client.Connect(listener.LocalEndPoint);
+
+            server = listener.Accept();
+        }
+
+        class IdleSession
+        {
+            Socket m_socket;
+
+            public IdleSession(Socket socket)
+            {
+                m_socket = socket;
+            }
+
+            public void Run()
+            {
+                //
+                // Blocks in the native Poll until the connection is closed, like an idle server session.
+                //
+                try
+                {
+                    m_socket.Poll(-1, SelectMode.SelectRead);
+                }
+                catch(Exception)
+                {
+                }
+            }
+        }
+
+        static long RoundTrips(Socket client, Socket server, byte[] buffer)
+        {
+            long start = DateTime.Now.Ticks;
+
+            for(int i = 0; i < c_Messages; i++)
+            {
+                client.Send(buffer);
+
+                server.Poll(-1, SelectMode.SelectRead);
+                server.Receive(buffer);
+                server.Send(buffer);
+
+                client.Poll(-1, SelectMode.SelectRead);
+                client.Receive(buffer);
+            }
+
+            return (DateTime.Now.Ticks - start) / 10 / c_Messages;
+        }
+
+        //
+        // The average round trip on one connection to address, first on its own and then with c_IdleConnections
+        // more connections blocked in Poll. SocketBenchmarkTests runs it on every path.
+        //
+        public static void Measure(IPAddress address, out long alone, out long crowded)
+        {
+            Socket   listener    = new Socket(AddressFamily.InterNetwork, SocketType.Stream, ProtocolType.Tcp);
+            Socket[] idleClients = new Socket[c_IdleConnections];
+            Socket[] idleServers = new Socket[c_IdleConnections];
+            byte[]   buffer      = new byte[1];
+            Socket   client      = null;
+            Socket   server      = null;
+
+            try
+            {
+                listener.Bind(new IPEndPoint(address, 0));
+                listener.Listen(c_IdleConnections + 1);
+
+                Connect(listener, out client, out server);
+
+                alone = RoundTrips(client, server, buffer);
+
+                for(int i = 0; i < c_IdleConnections; i++)
+                {
+                    Connect(listener, out idleClients[i], out idleServers[i]);
+
+                    new Thread(new ThreadStart(new IdleSession(idleServers[i]).Run)).Start();
+                }
+
+                Thread.Sleep(100);
+
+                crowded = RoundTrips(client, server, buffer);
+            }
+            finally
+            {
+                for(int i = 0; i < c_IdleConnections; i++)
+                {
+                    if(idleClients[i] != null) idleClients[i].Close();
+                    if(idleServers[i] != null) idleServers[i].Close();
+                }
+
+                if(client != null) client.Close();
+                if(server != null) server.Close();
+
+                listener.Close();
+            }
+        }
+
+        [TestMethod]
+        public MFTestResults Sockets_IdleConnectionScaling()
+        {
+            long alone;
+            long crowded;
+
+            Measure(IPAddress.Loopback, out alone, out crowded);
+
+            Log.Comment("Round trip with no idle connections: " + alone + " usec");
+            Log.Comment("Round trip with " + c_IdleConnections + " idle connections: " + crowded + " usec");
+
+            SocketTools.ReportResult("idle_scaling", "loopback", "round_trip_alone"  , alone  , "usec");
+            SocketTools.ReportResult("idle_scaling", "loopback", "round_trip_crowded", crowded, "usec");
+
+            return MFTestResults.Pass;
+        }
+    }
+}
@@ -11,7 +11,7 @@ namespace Microsoft.SPOT.Platform.Tests
         public static void Main()
         {
             // TODO: Add your other test classes to args.
-            string[] args = { "Sockets" };
+            string[] args = { "Sockets", "IdleConnectionTests", "BulkReceiveTests", "SendVectorTests", "DnsCacheTests", "SocketBenchmarkTests" };
             MFTestRunner runner = new MFTestRunner(args);
         }
     }
@@ -0,0 +1,164 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+using System;
+using System.Net;
+using System.Net.Sockets;
+using Microsoft.SPOT.Platform.Test;
+
+namespace Microsoft.SPOT.Platform.Tests
+{
+    public class SendVectorTests : IMFTestInterface
+    {
+        const int c_Messages = 200;
+        const int c_BodySize = 200;
+
+        Socket m_listener;
+        Socket m_client;
+        Socket m_server;
+        byte[] m_header;
+        byte[] m_body;
+        byte[] m_buffer;
+
+        [SetUp]
+        public InitializeResult Initialize()
+        {
+            Log.Comment("Header plus body messages on loopback: two sends, a concatenated send and SendVector.");
+
+            m_listener = new Socket(AddressFamily.InterNetwork, SocketType.Stream, ProtocolType.Tcp);
+            m_listener.Bind(new IPEndPoint(IPAddress.Loopback, 0));
+            m_listener.Listen(1);
+
+            m_client = new Socket(AddressFamily.InterNetwork, SocketType.Stream, ProtocolType.Tcp);
+            m_client.Connect(m_listener.LocalEndPoint);
+
+            m_server = m_listener.Accept();
+
+            m_header = System.Text.Encoding.UTF8.GetBytes("HTTP/1.1 200 OK\r\nContent-Length: " + c_BodySize + "\r\n\r\n");
+            m_body   = new byte[c_BodySize];
+            m_buffer = new byte[m_header.Length + c_BodySize];
+
+            for(int i = 0; i < c_BodySize; i++) m_body[i] = (byte)i;
+
+            return InitializeResult.ReadyToGo;
+        }
+
+        [TearDown]
+        public void CleanUp()
+        {
+            m_client  .Close();
+            m_server  .Close();
+            m_listener.Close();
+        }
+
+        delegate void SendMessage();
+
+        void SendTwice()
+        {
+            m_client.Send(m_header);
+            m_client.Send(m_body);
+        }
+
+        void SendConcatenated()
+        {
+            byte[] message = new byte[m_header.Length + m_body.Length];
+
+            Array.Copy(m_header, 0, message, 0              , m_header.Length);
+            Array.Copy(m_body  , 0, message, m_header.Length, m_body  .Length);
+
+            m_client.Send(message);
+        }
+
+        void SendVector()
+        {
+            m_client.SendVector(new byte[][] { m_header, m_body }, new int[] { 0, 0 }, new int[] { m_header.Length, m_body.Length });
+        }
+
+        //
+        // SOCK_TCP_SEGMENTS_SENT in Sockets_decl.h: segments with data the connection has put on the wire,
+        // counted by the sending stack itself. Receive calls are no measure of that, one Receive drains
+        // whatever segments have already arrived.
+        //
+        const SocketOptionName c_SegmentsSent = (SocketOptionName)0x7101;
+
+        //
+        // -1 on stacks that do not count them (RTIP, the emulator).
+        //
+        int SegmentsSent()
+        {
+            try
+            {
+                return (int)m_client.GetSocketOption(SocketOptionLevel.Tcp, c_SegmentsSent);
+            }
+            catch(SocketException)
+            {
+                return -1;
+            }
+        }
+
+        //
+        // Each message is read back before the next is sent, so no two messages can share a segment.
+        //
+        bool Run(string name, SendMessage send, bool fSingleSegment)
+        {
+            bool ok     = true;
+            int  before = SegmentsSent();
+            long start  = DateTime.Now.Ticks;
+
+            for(int i = 0; i < c_Messages; i++)
+            {
+                send();
+
+                int received = 0;
+
+                while(received < m_buffer.Length)
+                {
+                    m_server.Poll(-1, SelectMode.SelectRead);
+
+                    int read = m_server.Receive(m_buffer, received, m_buffer.Length - received, SocketFlags.None);
+
+                    if(read <= 0) return false;
+
+                    received += read;
+                }
+
+                ok &= m_buffer[0] == (byte)'H' && m_buffer[m_buffer.Length - 1] == (byte)(c_BodySize - 1);
+            }
+
+            long usec  = (DateTime.Now.Ticks - start) / 10;
+            int  after = SegmentsSent();
+
+            if(before < 0 || after < 0)
+            {
+                Log.Comment(name + ": " + (usec / c_Messages) + " usec per message, segments not counted by this stack");
+            }
+            else
+            {
+                int segments = after - before;
+
+                Log.Comment(name + ": " + (usec / c_Messages) + " usec per message, " + segments + " segments sent for " + c_Messages + " messages");
+
+                if(fSingleSegment && segments != c_Messages)
+                {
+                    Log.Comment(name + ": expected one segment per message");
+
+                    ok = false;
+                }
+            }
+
+            return ok;
+        }
+
+        [TestMethod]
+        public MFTestResults Sockets_SendVector()
+        {
+            bool ok = true;
+
+            ok &= Run("Two sends"         , new SendMessage(SendTwice       ), false);
+            ok &= Run("Concatenated send" , new SendMessage(SendConcatenated), true );
+            ok &= Run("SendVector"        , new SendMessage(SendVector      ), true );
+
+            return ok ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+    }
+}
@@ -0,0 +1,436 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+using System;
+using System.Net;
+using System.Net.Sockets;
+using System.Threading;
+using Microsoft.SPOT.Platform.Test;
+
+namespace Microsoft.SPOT.Platform.Tests
+{
+    //
+    // End to end socket benchmarks. Every scenario runs over the loopback interface and, when the
+    // firmware is built with NETWORK_USE_VIRTUAL_WIRE, over the virtual wire too, where the traffic
+    // also goes through ARP, Ethernet framing and a deferred receive. Results are reported with
+    // SocketTools.ReportResult so a run can be compared against another one.
+    //
+    public class SocketBenchmarkTests : IMFTestInterface
+    {
+        const int c_BulkTotal       = 256 * 1024;
+        const int c_BulkChunk       = 1024;
+        const int c_RequestSize     = 64;
+        const int c_RoundTrips      = 200;
+        const int c_Connections     = 50;
+        const int c_Datagrams       = 500;
+        const int c_DatagramSize    = 64;
+        const int c_DatagramWait    = 500 * 1000;
+
+        string[]    m_paths;
+        IPAddress[] m_addresses;
+
+        [SetUp]
+        public InitializeResult Initialize()
+        {
+            Log.Comment("Socket benchmarks: bulk TCP, request/response, connection setup, idle scaling and UDP packet rate.");
+
+            IPAddress wire = new IPAddress(SocketTools.DottedDecimalToIp(10, 254, 0, 2));
+
+            if(ProbeVirtualWire(wire))
+            {
+                m_paths     = new string   [] { "loopback"        , "wire" };
+                m_addresses = new IPAddress[] { IPAddress.Loopback, wire   };
+            }
+            else
+            {
+                Log.Comment("Virtual wire not present, measuring loopback only.");
+
+                m_paths     = new string   [] { "loopback"         };
+                m_addresses = new IPAddress[] { IPAddress.Loopback };
+            }
+
+            return InitializeResult.ReadyToGo;
+        }
+
+        [TearDown]
+        public void CleanUp()
+        {
+        }
+
+        static bool ProbeVirtualWire(IPAddress address)
+        {
+            Socket receiver = new Socket(AddressFamily.InterNetwork, SocketType.Dgram, ProtocolType.Udp);
+            Socket sender   = new Socket(AddressFamily.InterNetwork, SocketType.Dgram, ProtocolType.Udp);
+
+            try
+            {
+                receiver.Bind(new IPEndPoint(address, 0));
+
+                sender.SendTo(new byte[1], receiver.LocalEndPoint);
+
+                return receiver.Poll(c_DatagramWait, SelectMode.SelectRead);
+            }
+            catch(SocketException)
+            {
+                return false;
+            }
+            finally
+            {
+                sender  .Close();
+                receiver.Close();
+            }
+        }
+
+        static long Microseconds()
+        {
+            return DateTime.Now.Ticks / 10;
+        }
+
+        static Socket Listen(IPAddress address, int backlog)
+        {
+            Socket listener = new Socket(AddressFamily.InterNetwork, SocketType.Stream, ProtocolType.Tcp);
+
+            listener.Bind(new IPEndPoint(address, 0));
+            listener.Listen(backlog);
+
+            return listener;
+        }
+
+        static void Connect(Socket listener, out Socket client, out Socket server)
+        {
+            client = new Socket(AddressFamily.InterNetwork, SocketType.Stream, ProtocolType.Tcp);
+            client.Connect(listener.LocalEndPoint);
+
+            server = listener.Accept();
+        }
+
+        static bool ReceiveAll(Socket socket, byte[] buffer)
+        {
+            int received = 0;
+
+            while(received < buffer.Length)
+            {
+                int read = socket.Receive(buffer, received, buffer.Length - received, SocketFlags.None);
+
+                if(read <= 0) return false;
+
+                received += read;
+            }
+
+            return true;
+        }
+
+        //--//
+
+        bool TcpBulk(string path, IPAddress address)
+        {
+            Socket listener = Listen(address, 1);
+            Socket client;
+            Socket server;
+            int    received;
+            int    calls;
+            long   usec;
+            bool   ok;
+
+            Connect(listener, out client, out server);
+
+            try
+            {
+                ok = BulkReceiveTests.Transfer(client, server, c_BulkTotal, c_BulkChunk, out received, out calls, out usec);
+            }
+            finally
+            {
+                client  .Close();
+                server  .Close();
+                listener.Close();
+            }
+
+            SocketTools.ReportResult("tcp_bulk", path, "throughput", (long)received * 1000000 / usec, "bytes/s");
+
+            return ok;
+        }
+
+        //--//
+
+        class Responder
+        {
+            Socket m_socket;
+
+            public Responder(Socket socket)
+            {
+                m_socket = socket;
+            }
+
+            public void Run()
+            {
+                byte[] request = new byte[c_RequestSize];
+
+                try
+                {
+                    while(ReceiveAll(m_socket, request))
+                    {
+                        m_socket.Send(request);
+                    }
+                }
+                catch(SocketException)
+                {
+                }
+            }
+        }
+
+        bool RequestResponse(string path, IPAddress address)
+        {
+            Socket listener = Listen(address, 1);
+            Socket client;
+            Socket server;
+
+            Connect(listener, out client, out server);
+
+            Thread responder = new Thread(new ThreadStart(new Responder(server).Run));
+
+            responder.Start();
+
+            byte[] request  = new byte[c_RequestSize];
+            byte[] response = new byte[c_RequestSize];
+            long   total    = 0;
+            long   worst    = 0;
+            bool   ok       = true;
+
+            for(int i = 0; i < c_RoundTrips && ok; i++)
+            {
+                request[0] = (byte)i;
+
+                long start = Microseconds();
+
+                client.Send(request);
+
+                ok = ReceiveAll(client, response) && response[0] == (byte)i;
+
+                long usec = Microseconds() - start;
+
+                total += usec;
+
+                if(usec > worst) worst = usec;
+            }
+
+            client.Close();
+
+            responder.Join();
+
+            server  .Close();
+            listener.Close();
+
+            SocketTools.ReportResult("request_response", path, "latency_avg", total / c_RoundTrips, "usec");
+            SocketTools.ReportResult("request_response", path, "latency_max", worst               , "usec");
+
+            return ok;
+        }
+
+        //--//
+
+        class Acceptor
+        {
+            Socket m_listener;
+
+            public int Accepted;
+
+            public Acceptor(Socket listener)
+            {
+                m_listener = listener;
+            }
+
+            public void Run()
+            {
+                for(Accepted = 0; Accepted < c_Connections; Accepted++)
+                {
+                    m_listener.Accept().Close();
+                }
+            }
+        }
+
+        bool ConnectionSetup(string path, IPAddress address)
+        {
+            Socket   listener = Listen(address, 2);
+            Acceptor acceptor = new Acceptor(listener);
+            Thread   thread   = new Thread(new ThreadStart(acceptor.Run));
+
+            thread.Start();
+
+            long start = Microseconds();
+
+            for(int i = 0; i < c_Connections; i++)
+            {
+                Socket client = new Socket(AddressFamily.InterNetwork, SocketType.Stream, ProtocolType.Tcp);
+
+                client.Connect(listener.LocalEndPoint);
+                client.Close();
+            }
+
+            thread.Join();
+
+            long usec = Microseconds() - start;
+
+            listener.Close();
+
+            if(usec == 0) usec = 1;
+
+            SocketTools.ReportResult("connection_setup", path, "rate", (long)acceptor.Accepted * 1000000 / usec, "connections/s");
+
+            return acceptor.Accepted == c_Connections;
+        }
+
+        //--//
+
+        bool IdleScaling(string path, IPAddress address)
+        {
+            long alone;
+            long crowded;
+
+            IdleConnectionTests.Measure(address, out alone, out crowded);
+
+            //
+            // IdleConnectionTests already reports idle_scaling on loopback; these runs cover every path under their own name.
+            //
+            SocketTools.ReportResult("idle_scaling_bench", path, "round_trip_alone"  , alone  , "usec");
+            SocketTools.ReportResult("idle_scaling_bench", path, "round_trip_crowded", crowded, "usec");
+
+            return true;
+        }
+
+        //--//
+
+        class DatagramSender
+        {
+            Socket   m_socket;
+            EndPoint m_destination;
+
+            public DatagramSender(Socket socket, EndPoint destination)
+            {
+                m_socket      = socket;
+                m_destination = destination;
+            }
+
+            public void Run()
+            {
+                byte[] datagram = new byte[c_DatagramSize];
+
+                for(int i = 0; i < c_Datagrams; i++)
+                {
+                    datagram[0] = (byte)i;
+
+                    m_socket.SendTo(datagram, m_destination);
+                }
+            }
+        }
+
+        bool UdpPacketRate(string path, IPAddress address)
+        {
+            Socket receiver = new Socket(AddressFamily.InterNetwork, SocketType.Dgram, ProtocolType.Udp);
+            Socket sender   = new Socket(AddressFamily.InterNetwork, SocketType.Dgram, ProtocolType.Udp);
+
+            receiver.Bind(new IPEndPoint(address, 0));
+
+            byte[] buffer   = new byte[c_DatagramSize];
+            int    received = 0;
+            long   first    = 0;
+            long   last     = 0;
+
+            Thread thread = new Thread(new ThreadStart(new DatagramSender(sender, receiver.LocalEndPoint).Run));
+
+            thread.Start();
+
+            //
+            // Datagrams the stack drops under load never arrive, so the receiver stops after a quiet period.
+            //
+            while(received < c_Datagrams && receiver.Poll(c_DatagramWait, SelectMode.SelectRead))
+            {
+                receiver.Receive(buffer);
+
+                last = Microseconds();
+
+                if(received++ == 0) first = last;
+            }
+
+            thread.Join();
+
+            sender  .Close();
+            receiver.Close();
+
+            long usec = last - first;
+
+            if(usec == 0) usec = 1;
+
+            //
+            // The rate is timed between the first and the last arrival, so it takes at least two datagrams.
+            //
+            if(received > 1)
+            {
+                SocketTools.ReportResult("udp_packet_rate", path, "rate", (long)(received - 1) * 1000000 / usec, "packets/s");
+            }
+
+            SocketTools.ReportResult("udp_packet_rate", path, "lost", c_Datagrams - received, "packets");
+
+            return received > 0;
+        }
+
+        //--//
+
+        delegate bool Scenario(string path, IPAddress address);
+
+        MFTestResults RunOnEveryPath(Scenario scenario)
+        {
+            bool ok = true;
+
+            for(int i = 0; i < m_paths.Length; i++)
+            {
+                try
+                {
+                    if(!scenario(m_paths[i], m_addresses[i]))
+                    {
+                        Log.Comment("Failed on path " + m_paths[i]);
+
+                        ok = false;
+                    }
+                }
+                catch(Exception e)
+                {
+                    Log.Comment("Exception on path " + m_paths[i] + ": " + e.Message);
+
+                    ok = false;
+                }
+            }
+
+            return ok ? MFTestResults.Pass : MFTestResults.Fail;
+        }
+
+        [TestMethod]
+        public MFTestResults Benchmark_TcpBulk()
+        {
+            return RunOnEveryPath(new Scenario(TcpBulk));
+        }
+
+        [TestMethod]
+        public MFTestResults Benchmark_RequestResponse()
+        {
+            return RunOnEveryPath(new Scenario(RequestResponse));
+        }
+
+        [TestMethod]
+        public MFTestResults Benchmark_ConnectionSetup()
+        {
+            return RunOnEveryPath(new Scenario(ConnectionSetup));
+        }
+
+        [TestMethod]
+        public MFTestResults Benchmark_IdleScaling()
+        {
+            return RunOnEveryPath(new Scenario(IdleScaling));
+        }
+
+        [TestMethod]
+        public MFTestResults Benchmark_UdpPacketRate()
+        {
+            return RunOnEveryPath(new Scenario(UdpPacketRate));
+        }
+    }
+}
@@ -71,6 +71,15 @@ namespace Microsoft.SPOT.Platform.Tests
         }
 
 
+        //
+        // One line per measurement, "RESULT,<scenario>,<path>,<metric>,<value>,<unit>", for tools
+        // that collect benchmark numbers from the test log.
+        //
+        public static void ReportResult(string scenario, string path, string metric, long value, string unit)
+        {
+            Log.Comment("RESULT," + scenario + "," + path + "," + metric + "," + value + "," + unit);
+        }
+
         public static bool ArrayEquals(bool[] array1, bool[] array2)
         {
             if (array1.Length != array2.Length)